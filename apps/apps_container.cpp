@@ -483,6 +483,8 @@ void AppsContainer::openDFU(bool blocking) {
   Ion::USB::DFU(blocking ? Ion::USB::DFUParameters::Blocking()
                          : Ion::USB::DFUParameters::PassThrough());
   m_batteryTimer.doNotShowModal();
+  // DFU might have written records in the storage
+  Ion::Storage::FileSystem::sharedFileSystem->invalidateIndex();
 
   /* DFU might have changed preferences and global preferences, update those
    * that have callbacks: country and exam mode.*/
@@ -56,6 +56,11 @@ class App : public Shared::MathApp {
   Snapshot* snapshot() const {
     return static_cast<Snapshot*>(Shared::SharedApp::snapshot());
   }
+  int numberOfIdleJobs() override { return 1; }
+  Escher::IdleJob* idleJobAtIndex(int i) override {
+    assert(i == 0);
+    return m_historyController.measureRowsJob();
+  }
 
  private:
   App(Snapshot* snapshot);
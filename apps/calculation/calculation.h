@@ -107,8 +107,10 @@ class Calculation {
       bool forEditing = false);
 
   // Heights
+  bool hasHeights() const { return m_height >= 0; }
   KDCoordinate height(bool expanded);
   void setHeights(KDCoordinate height, KDCoordinate expandedHeight);
+  void resetHeights() { setHeights(-1, -1); }
 
   // Displayed output
   DisplayOutput displayOutput() const {
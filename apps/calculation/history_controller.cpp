@@ -5,6 +5,8 @@
 #include <poincare/context.h>
 #include <poincare/exception_checkpoint.h>
 
+#include <algorithm>
+
 #include "app.h"
 
 using namespace Shared;
@@ -19,6 +21,8 @@ HistoryController::HistoryController(
     : ViewController(editExpressionController),
       m_selectableListView(this, this, this, this),
       m_calculationStore(calculationStore),
+      m_firstMeasuredRow(0),
+      m_measureRowsJob(this),
       m_additionalResultsController(editExpressionController) {
   for (int i = 0; i < k_maxNumberOfDisplayedRows; i++) {
     m_calculationHistory[i].setParentResponder(&m_selectableListView);
@@ -125,6 +129,9 @@ void HistoryController::listViewDidChangeSelectionAndDidScroll(
     SelectableListView* list, int previousSelectedRow, KDPoint previousOffset,
     bool withinTemporarySelection) {
   assert(list == &m_selectableListView);
+  if (!withinTemporarySelection && selectedRow() >= 0) {
+    measureRowsAboveRow(selectedRow());
+  }
   m_selectableListView.didChangeSelectionAndDidScroll();
   if (withinTemporarySelection || previousSelectedRow == selectedRow()) {
     return;
@@ -155,7 +162,9 @@ KDPoint HistoryController::offsetToRestoreAfterReload(
       selectedRow < m_calculationStore->numberOfCalculations()) {
     Shared::ExpiringPointer<Calculation> calculation =
         calculationAtIndex(selectedRow);
-    delta = calculation->height(true) - calculation->height(false);
+    if (calculation->hasHeights()) {
+      delta = calculation->height(true) - calculation->height(false);
+    }
   }
   return m_selectableListView.contentOffset().translatedBy(KDPoint(delta, 0));
 }
@@ -164,14 +173,52 @@ void HistoryController::recomputeHistoryCellHeightsIfNeeded() {
   if (!m_calculationStore->preferencesHaveChanged()) {
     return;
   }
-  for (int i = 0; i < numberOfRows(); i++) {
+  /* Measuring every calculation again would block the app opening with a
+   * full history, so the heights are only forgotten here and computed again
+   * by nonMemoizedRowHeight for the rows near the bottom of the history. */
+  int n = numberOfRows();
+  for (int i = 0; i < n; i++) {
+    calculationAtIndex(i)->resetHeights();
+  }
+  m_firstMeasuredRow = std::max(0, n - k_numberOfRowsMeasuredAhead);
+}
+
+void HistoryController::measureRowsAboveRow(int row) {
+  int firstRow = std::max(0, row - k_numberOfRowsMeasuredAhead);
+  if (firstRow >= m_firstMeasuredRow) {
+    return;
+  }
+  /* The rows between firstRow and m_firstMeasuredRow are above the displayed
+   * ones, so the content offset is shifted by the difference between their
+   * estimated and actual heights to keep the displayed rows in place. */
+  KDCoordinate delta = 0;
+  for (int i = firstRow; i < m_firstMeasuredRow; i++) {
+    Shared::ExpiringPointer<Calculation> calculation = calculationAtIndex(i);
+    if (calculation->hasHeights()) {
+      continue;
+    }
     /* The void context is used since there is no reasons for the
      * heightComputer to resolve symbols */
-    HistoryViewCell::ComputeCalculationHeights(calculationAtIndex(i).pointer(),
-                                               nullptr);
+    HistoryViewCell::ComputeCalculationHeights(calculation.pointer(), nullptr);
+    delta += calculation->height(false) - k_estimatedRowHeight;
+  }
+  m_firstMeasuredRow = firstRow;
+  if (delta != 0) {
+    KDPoint offset = m_selectableListView.contentOffset();
+    m_selectableListView.resetSizeAndOffsetMemoization();
+    m_selectableListView.setContentOffset(
+        offset.translatedBy(KDPoint(0, delta)));
   }
 }
 
+bool HistoryController::MeasureRowsJob::work() {
+  // Measure a single row, right above the measured ones
+  m_historyController->measureRowsAboveRow(
+      m_historyController->m_firstMeasuredRow - 1 +
+      k_numberOfRowsMeasuredAhead);
+  return true;
+}
+
 int HistoryController::numberOfRows() const {
   return m_calculationStore->numberOfCalculations();
 };
@@ -204,6 +251,12 @@ KDCoordinate HistoryController::nonMemoizedRowHeight(int row) {
     return 0;
   }
   Shared::ExpiringPointer<Calculation> calculation = calculationAtIndex(row);
+  if (!calculation->hasHeights()) {
+    if (row < m_firstMeasuredRow) {
+      return k_estimatedRowHeight;
+    }
+    HistoryViewCell::ComputeCalculationHeights(calculation.pointer(), nullptr);
+  }
   bool expanded =
       row == selectedRow() && m_selectedSubviewType == SubviewType::Output;
   return calculation->height(expanded);
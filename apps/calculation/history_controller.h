@@ -2,6 +2,7 @@
 #define CALCULATION_HISTORY_CONTROLLER_H
 
 #include <apps/calculation/additional_results/additional_results_controller.h>
+#include <escher/idle_job.h>
 
 #include "calculation_selectable_list_view.h"
 #include "calculation_store.h"
@@ -35,6 +36,7 @@ class HistoryController : public Escher::ViewController,
   KDPoint offsetToRestoreAfterReload(
       const Escher::SelectableTableView* t) const override;
   void recomputeHistoryCellHeightsIfNeeded();
+  Escher::IdleJob* measureRowsJob() { return &m_measureRowsJob; }
 
  protected:
   void handleResponderChainEvent(ResponderChainEvent event) override;
@@ -45,13 +47,44 @@ class HistoryController : public Escher::ViewController,
   int storeIndex(int i) const { return numberOfRows() - i - 1; }
   Shared::ExpiringPointer<Calculation> calculationAtIndex(int i) const;
   bool calculationAtIndexToggles(int index) const;
+  void measureRowsAboveRow(int row);
   void handleOK();
 
+  // Measures the rows above m_firstMeasuredRow while the user is not active
+  class MeasureRowsJob : public Escher::IdleJob {
+   public:
+    MeasureRowsJob(HistoryController* historyController)
+        : Escher::IdleJob(Priority::Low),
+          m_historyController(historyController) {}
+    bool hasPendingWork() override {
+      return m_historyController->m_firstMeasuredRow > 0;
+    }
+
+   private:
+    bool work() override;
+    HistoryController* m_historyController;
+  };
+
   constexpr static int k_maxNumberOfDisplayedRows = 6;
+  /* After a preferences change, the heights of the calculations are only
+   * computed again when they come near the displayed rows. The rows above
+   * m_firstMeasuredRow that have not been measured yet use an estimated
+   * height, that is corrected when the selection goes up. The estimate is
+   * the height of a single line calculation, which is the smallest one, so
+   * that estimated rows never need more than k_maxNumberOfDisplayedRows
+   * cells. */
+  constexpr static int k_numberOfRowsMeasuredAhead =
+      2 * k_maxNumberOfDisplayedRows;
+  constexpr static KDCoordinate k_estimatedRowHeight =
+      2 * HistoryViewCell::k_margin +
+      2 * HistoryViewCell::k_inputOutputViewsVerticalMargin +
+      KDFont::GlyphHeight(KDFont::Size::Large);
 
   CalculationSelectableListView m_selectableListView;
   HistoryViewCell m_calculationHistory[k_maxNumberOfDisplayedRows];
   CalculationStore* m_calculationStore;
+  int m_firstMeasuredRow;
+  MeasureRowsJob m_measureRowsJob;
   AdditionalResultsController m_additionalResultsController;
 };
 
@@ -67,6 +67,13 @@ class App : public Shared::FunctionApp {
   GraphController* graphController() {
     return &m_tabs.tab<GraphTab>()->m_graphController;
   }
+  int numberOfIdleJobs() override {
+    return m_tabs.activeTabIsOfType<GraphTab>();
+  }
+  Escher::IdleJob* idleJobAtIndex(int i) override {
+    assert(i == 0);
+    return graphController()->pointsOfInterestJob();
+  }
 
  private:
   App(Snapshot* snapshot);
@@ -27,7 +27,8 @@ GraphController::GraphController(
       m_curveParameterController(interactiveRange, &m_bannerView, m_cursor,
                                  &m_view, this, functionParameterController,
                                  derivativeColumnParameterController),
-      m_functionSelectionController(this) {
+      m_functionSelectionController(this),
+      m_pointsOfInterestJob(this) {
   m_graphRange->setDelegate(this);
   showGridTypeMenu(true);
 }
@@ -57,13 +58,29 @@ void GraphController::handleResponderChainEvent(
 
 bool GraphController::handleEvent(Ion::Events::Event event) {
   if (event == Ion::Events::Idle) {
-    // Compute the points of interest when the user is not active
-    m_view.resumePointsOfInterestDrawing();
+    // The points of interest are computed by m_pointsOfInterestJob
     return true;
   }
   return Shared::FunctionGraphController::handleEvent(event);
 }
 
+bool GraphController::PointsOfInterestJob::hasPendingWork() {
+  GraphView* view = &m_graphController->m_view;
+  return view->displaysPointsOfInterest() &&
+         !m_graphController->pointsOfInterestForRecord(view->selectedRecord())
+              ->isFullyComputed();
+}
+
+bool GraphController::PointsOfInterestJob::work() {
+  GraphView* view = &m_graphController->m_view;
+  PointsOfInterestCache* cache =
+      m_graphController->pointsOfInterestForRecord(view->selectedRecord());
+  bool interrupted = !cache->computeNextStep(true) && !cache->isFullyComputed();
+  // Draw the points found so far
+  view->resumePointsOfInterestDrawing();
+  return !interrupted;
+}
+
 struct ContinuousFunctionAndContext {
   const ContinuousFunction* func;
   Context* ctx;
@@ -6,6 +6,7 @@
 #include <apps/shared/function_graph_controller.h>
 #include <apps/shared/interactive_curve_view_range.h>
 #include <apps/shared/round_cursor_view.h>
+#include <escher/idle_job.h>
 #include <omg/ring_buffer.h>
 
 #include "banner_view.h"
@@ -54,11 +55,26 @@ class GraphController : public Shared::FunctionGraphController,
   PointsOfInterestCache* pointsOfInterestForSelectedRecord() {
     return pointsOfInterestForRecord(recordAtSelectedCurveIndex());
   }
+  Escher::IdleJob* pointsOfInterestJob() { return &m_pointsOfInterestJob; }
 
  protected:
   void handleResponderChainEvent(ResponderChainEvent event) override;
 
  private:
+  /* Computes the points of interest of the selected curve while the user is
+   * not active, one step of the cache at a time, and draws them as they are
+   * found. */
+  class PointsOfInterestJob : public Escher::IdleJob {
+   public:
+    PointsOfInterestJob(GraphController* graphController)
+        : m_graphController(graphController) {}
+    bool hasPendingWork() override;
+
+   private:
+    bool work() override;
+    GraphController* m_graphController;
+  };
+
   class FunctionSelectionController
       : public Shared::FunctionGraphController::FunctionSelectionController {
    public:
@@ -152,6 +168,7 @@ class GraphController : public Shared::FunctionGraphController,
   FunctionSelectionController m_functionSelectionController;
   constexpr static int k_numberOfCaches = 5;
   OMG::RingBuffer<PointsOfInterestCache, k_numberOfCaches> m_pointsOfInterest;
+  PointsOfInterestJob m_pointsOfInterestJob;
 };
 
 }  // namespace Graph
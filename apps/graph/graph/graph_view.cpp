@@ -18,7 +18,6 @@ GraphView::GraphView(InteractiveCurveViewRange* graphRange,
       m_areaIndex(0),
       m_nextPointOfInterestIndex(0),
       m_interest(Solver<double>::Interest::None),
-      m_computePointsOfInterest(false),
       m_tangentDisplay(false) {}
 
 void GraphView::reload(bool resetInterrupted, bool force,
@@ -38,6 +37,32 @@ void GraphView::drawRect(KDContext* ctx, KDRect rect) const {
   FunctionGraphView::drawRect(ctx, rect);
 }
 
+bool GraphView::willMovePixelsOnPan() {
+  /* Areas are filled with a pattern aligned on the view, dotted curves and
+   * tangents are drawn from the edges of the redrawn rect, and the labels of
+   * the polar grid are stuck to the edges of the view. */
+  if (m_tangentDisplay || std::isfinite(m_highlightedStart) ||
+      !axesFollowPan() ||
+      static_cast<InteractiveCurveViewRange*>(range())->gridType() ==
+          InteractiveCurveViewRange::GridType::Polar) {
+    return false;
+  }
+  int n = functionStore()->numberOfActiveFunctions();
+  for (int i = 0; i < n; i++) {
+    ExpiringPointer<ContinuousFunction> f = functionStore()->modelForRecord(
+        functionStore()->activeRecordAtIndex(i));
+    if (f->properties().areaType() !=
+            ContinuousFunctionProperties::AreaType::None ||
+        f->properties().plotIsDotted()) {
+      return false;
+    }
+  }
+  /* The points of interest already drawn moved with the plot, and those in the
+   * redrawn rects are drawn again. */
+  m_nextPointOfInterestIndex = 0;
+  return true;
+}
+
 int GraphView::selectedRecordIndex() const {
   return functionStore()->indexOfRecordAmongActiveRecords(m_selectedRecord);
 }
@@ -544,28 +569,32 @@ void GraphView::drawScatterPlot(KDContext* ctx, KDRect rect,
 }
 
 void GraphView::resumePointsOfInterestDrawing() {
-  m_computePointsOfInterest = true;
   m_interestView.dirtyBounds();
 }
 
+bool GraphView::displaysPointsOfInterest() const {
+  Ion::Storage::Record selectedRec = selectedRecord();
+  if (!hasFocus() || selectedRec.isNull()) {
+    return false;
+  }
+  return functionStore()
+             ->modelForRecord(selectedRec)
+             ->properties()
+             .isCartesian() &&
+         !functionWasInterrupted(
+             functionStore()->indexOfRecordAmongActiveRecords(selectedRec));
+}
+
 void GraphView::drawPointsOfInterest(KDContext* ctx, KDRect rect) {
-  if (!hasFocus()) {
+  if (!displaysPointsOfInterest()) {
     return;
   }
 
-  bool shouldComputePoints = m_computePointsOfInterest;
-  m_computePointsOfInterest = false;
-
   Ion::Storage::Record selectedRec = selectedRecord();
-  ExpiringPointer<ContinuousFunction> f =
-      functionStore()->modelForRecord(selectedRec);
-  bool isStrictInequality = f->properties().isStrictInequality();
-
-  if (!f->properties().isCartesian() ||
-      functionWasInterrupted(
-          functionStore()->indexOfRecordAmongActiveRecords(selectedRec))) {
-    return;
-  }
+  bool isStrictInequality = functionStore()
+                                ->modelForRecord(selectedRec)
+                                ->properties()
+                                .isStrictInequality();
 
   PointsOfInterestCache* pointsOfInterestCache =
       App::app()->graphController()->pointsOfInterestForRecord(selectedRec);
@@ -575,13 +604,6 @@ void GraphView::drawPointsOfInterest(KDContext* ctx, KDRect rect) {
   Coordinate2D<float> lastBlackDot;
   int i = 0;
   do {
-    // Compute more points of interest if necessary
-    if (shouldComputePoints &&
-        !pointsOfInterestCache->computeUntilNthPoint(i)) {
-      // Computation was interrupted
-      return;
-    }
-
     if (i >= pointsOfInterestCache->numberOfPoints()) {
       return;
     }
@@ -41,7 +41,9 @@ class GraphView : public Shared::FunctionGraphView,
   void setInterest(Poincare::Solver<double>::Interest interest) {
     m_interest = interest;
   }
+  // Draw the points of interest computed since the last draw
   void resumePointsOfInterestDrawing();
+  bool displaysPointsOfInterest() const;
 
   void setTangentDisplay(bool display) { m_tangentDisplay = display; }
 
@@ -53,6 +55,7 @@ class GraphView : public Shared::FunctionGraphView,
                                                      float maxBound,
                                                      void* model,
                                                      void* context);
+  bool willMovePixelsOnPan() override;
   Escher::View* ornamentView() const override {
     return const_cast<InterestView*>(&m_interestView);
   }
@@ -85,7 +88,6 @@ class GraphView : public Shared::FunctionGraphView,
   mutable int m_nextPointOfInterestIndex;
 
   Poincare::Solver<double>::Interest m_interest;
-  bool m_computePointsOfInterest;
   bool m_tangentDisplay;
 };
 
@@ -849,6 +849,36 @@ QUIZ_CASE(sequence_order) {
   store->tidyDownstreamPoolFrom();
 }
 
+QUIZ_CASE(sequence_evaluation_at_distant_ranks) {
+  Shared::GlobalContext globalContext;
+  SequenceStore* store = globalContext.s_sequenceStore;
+  SequenceContext* sequenceContext = globalContext.sequenceContext();
+
+  // u(n) = n(n-1)/2, v(n) = n, w(n) = 2n+1
+  Sequence* u = addSequence(store, Sequence::Type::SingleRecurrence,
+                            "u(n)+v(n)", "0", nullptr, sequenceContext);
+  Sequence* v = addSequence(store, Sequence::Type::SingleRecurrence, "v(n)+1",
+                            "0", nullptr, sequenceContext);
+  Sequence* w = addSequence(store, Sequence::Type::DoubleRecurrence,
+                            "2w(n+1)-w(n)", "1", "3", sequenceContext);
+
+  /* Going back to a lower rank restarts from the closest checkpoint, which
+   * must give the same values as stepping from the initial rank. */
+  int ranks[] = {9000, 5000, 8999, 257, 256, 255, 9000};
+  for (int n : ranks) {
+    double x = static_cast<double>(n);
+    quiz_assert(u->evaluateXYAtParameter(x, sequenceContext).y() ==
+                x * (x - 1.) / 2.);
+    quiz_assert(v->evaluateXYAtParameter(x, sequenceContext).y() == x);
+    quiz_assert(w->evaluateXYAtParameter(x, sequenceContext).y() ==
+                2. * x + 1.);
+  }
+
+  store->removeAll();
+  store->tidyDownstreamPoolFrom();
+  sequenceContext->resetCache();
+}
+
 QUIZ_CASE(sequence_sum_evaluation) {
   check_sum_of_sequence_between_bounds(33.0, 3.0, 8.0, Sequence::Type::Explicit,
                                        "n", nullptr, nullptr);
@@ -519,7 +519,11 @@ Coordinate2D<T> ContinuousFunction::templatedApproximateAtParameter(
       assert(e.isList());
       assert(static_cast<List&>(e).numberOfChildren() > subCurveIndex);
     }
-    T value = e.approximateToRealScalarWithValue<T>(t, subCurveIndex);
+    const Internal::Approximation::Program& program =
+        m_model.programApproximated();
+    T value = derivationOrder == 0 && program.isValid()
+                  ? program.to<T>(t)
+                  : e.approximateToRealScalarWithValue<T>(t, subCurveIndex);
     if (isAlongY()) {
       // Invert x and y with vertical lines so it can be scrolled vertically
       return Coordinate2D<T>(value, t);
@@ -533,6 +537,30 @@ Coordinate2D<T> ContinuousFunction::templatedApproximateAtParameter(
   return e.approximateToPointOrRealScalarWithValue<T>(t).toPoint();
 }
 
+bool ContinuousFunction::privateEvaluateYAtParameters(
+    std::span<const float> t, std::span<float> y, Context* context) const {
+  assert(t.size() == y.size());
+  if (!properties().isCartesian() || isAlongY()) {
+    return false;
+  }
+  // Memoize the approximated expression and its program
+  expressionApproximated(context, 0);
+  const Internal::Approximation::Program& program =
+      m_model.programApproximated();
+  if (!program.isValid()) {
+    return false;
+  }
+  program.to<float>(t, y);
+  float tMinimum = tMin();
+  float tMaximum = tMax();
+  for (size_t i = 0; i < t.size(); i++) {
+    if (t[i] < tMinimum || t[i] > tMaximum) {
+      y[i] = NAN;
+    }
+  }
+  return true;
+}
+
 ContinuousFunction::RecordDataBuffer::RecordDataBuffer(KDColor color)
     : Shared::Function::RecordDataBuffer(color),
       m_domain(-INFINITY, INFINITY),
@@ -757,6 +785,10 @@ Poincare::SystemFunction ContinuousFunction::Model::expressionApproximated(
         e.getSystemFunction(properties(record).isAlongY()
                                 ? ContinuousFunctionProperties::k_ordinateName
                                 : k_unknownName);
+    if (derivationOrder == 0) {
+      m_programApproximated =
+          Internal::Approximation::Program::Compile(approximated->tree());
+    }
   }
   return *approximated;
 }
@@ -1119,6 +1151,9 @@ void ContinuousFunction::Model::tidyDownstreamPoolFrom(
   TidyIfDownStreamOf(m_expressionSecondDerivateApproximated, treePoolCursor);
   TidyIfDownStreamOf(m_expressionSlope, treePoolCursor);
   TidyIfDownStreamOf(m_expressionApproximated, treePoolCursor);
+  if (m_expressionApproximated.isUninitialized()) {
+    m_programApproximated = Internal::Approximation::Program();
+  }
   TidyIfDownStreamOf(m_expressionForAnalysis, treePoolCursor);
   ExpressionModel::tidyDownstreamPoolFrom(treePoolCursor);
 }
@@ -14,6 +14,9 @@
 #include <poincare/helpers/scatter_plot_iterable.h>
 #include <poincare/point_or_scalar.h>
 #include <poincare/preferences.h>
+#include <poincare/src/expression/approximation_program.h>
+
+#include <span>
 
 #include "continuous_function_cache.h"
 #include "continuous_function_properties.h"
@@ -23,8 +26,9 @@
 namespace Shared {
 
 class ContinuousFunction : public Function {
-  /* We want the cache to be able to call privateEvaluateXYAtParameter to
-   * bypass cache lookup when memoizing the function's values. */
+  /* We want the cache to be able to call privateEvaluateXYAtParameter and
+   * privateEvaluateYAtParameters to bypass cache lookup when memoizing the
+   * function's values. */
   friend class ContinuousFunctionCache;
 
  public:
@@ -285,6 +289,12 @@ class ContinuousFunction : public Function {
   template <typename T>
   Poincare::Coordinate2D<T> templatedApproximateAtParameter(
       T t, Poincare::Context* context, int subCurveIndex = -1) const;
+  /* Evaluate the first curve of a cartesian function at several parameters at
+   * once. Return false if the function cannot be approximated in batch, y is
+   * then left untouched. */
+  bool privateEvaluateYAtParameters(std::span<const float> t,
+                                    std::span<float> y,
+                                    Poincare::Context* context) const;
 
   /* Record */
 
@@ -385,6 +395,13 @@ class ContinuousFunction : public Function {
     Poincare::SystemFunction expressionApproximated(
         const Ion::Storage::Record* record, Poincare::Context* context,
         int derivationOrder = 0) const;
+    /* Return expressionApproximated compiled for faster approximations. It is
+     * only valid once expressionApproximated has been computed and if it
+     * could be compiled. */
+    const Poincare::Internal::Approximation::Program& programApproximated()
+        const {
+      return m_programApproximated;
+    }
     // Return the expression reduced, and computes plotType
     Poincare::SystemExpression expressionReducedForAnalysis(
         const Ion::Storage::Record* record, Poincare::Context* context) const;
@@ -448,6 +465,7 @@ class ContinuousFunction : public Function {
      */
     mutable Poincare::SystemExpression m_expressionForAnalysis;
     mutable Poincare::SystemFunction m_expressionApproximated;
+    mutable Poincare::Internal::Approximation::Program m_programApproximated;
     mutable Poincare::SystemExpression m_expressionFirstDerivate;
     mutable Poincare::SystemFunction m_expressionFirstDerivateApproximated;
     mutable Poincare::SystemExpression m_expressionSecondDerivate;
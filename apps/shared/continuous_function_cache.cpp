@@ -135,7 +135,8 @@ Poincare::Coordinate2D<float> ContinuousFunctionCache::valuesAtIndex(
     int i, int curveIndex) {
   assert(curveIndex == 0);
   if (function->properties().isCartesian()) {
-    if (OMG::IsSignalingNan(m_cache[i])) {
+    if (OMG::IsSignalingNan(m_cache[i]) &&
+        !fillCartesianValuesFrom(function, context, t, i)) {
       m_cache[i] =
           function->privateEvaluateXYAtParameter(t, context, curveIndex).y();
     }
@@ -151,6 +152,33 @@ Poincare::Coordinate2D<float> ContinuousFunctionCache::valuesAtIndex(
   return Poincare::Coordinate2D<float>(m_cache[2 * i], m_cache[2 * i + 1]);
 }
 
+bool ContinuousFunctionCache::fillCartesianValuesFrom(
+    const ContinuousFunction* function, Poincare::Context* context, float t,
+    int i) {
+  assert(function->properties().isCartesian());
+  /* Curves are drawn along increasing parameters: approximate the next
+   * missing values along with the requested one. */
+  int firstIndex = (i - m_startOfCache + k_sizeOfCache) % k_sizeOfCache;
+  float parameters[k_maxBatchLength];
+  float values[k_maxBatchLength];
+  parameters[0] = t;
+  int n = 1;
+  while (n < k_maxBatchLength && firstIndex + n < k_sizeOfCache &&
+         OMG::IsSignalingNan(m_cache[(i + n) % k_sizeOfCache])) {
+    parameters[n] = m_tMin + (firstIndex + n) * m_tStep;
+    n++;
+  }
+  if (!function->privateEvaluateYAtParameters(
+          std::span<const float>(parameters, n), std::span<float>(values, n),
+          context)) {
+    return false;
+  }
+  for (int k = 0; k < n; k++) {
+    m_cache[(i + k) % k_sizeOfCache] = values[k];
+  }
+  return true;
+}
+
 void ContinuousFunctionCache::pan(ContinuousFunction* function, float newTMin) {
   assert(function->properties().isCartesian());
   if (newTMin == m_tMin) {
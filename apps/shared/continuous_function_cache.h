@@ -48,9 +48,12 @@ class ContinuousFunctionCache {
    * which would lead to no curve at all. With 80.0938275501223, the
    * problematic functions are the functions whose period is proportioned to
    * 80.0938275501223 which are hopefully rare enough.
-   * TODO: The drawCurve algorithm should use the derivative function to know
-   * how fast the function moves... */
+   * Within a step, CurveDrawing only subdivides where the curve bends away
+   * from its chord, so that straight parts cost few evaluations. */
   constexpr static float k_graphStepDenominator = 80.0938275501223f;
+  /* Maximal number of missing cartesian values approximated at once when one
+   * of them is requested. */
+  constexpr static int k_maxBatchLength = 32;
 
   void invalidateBetween(int iInf, int iSup);
   void setRange(float tMin, float tStep);
@@ -59,6 +62,8 @@ class ContinuousFunctionCache {
   Poincare::Coordinate2D<float> valuesAtIndex(
       const ContinuousFunction* function, Poincare::Context* context, float t,
       int i, int curveIndex);
+  bool fillCartesianValuesFrom(const ContinuousFunction* function,
+                               Poincare::Context* context, float t, int i);
   void pan(ContinuousFunction* function, float newTMin);
 
   float m_tMin, m_tStep;
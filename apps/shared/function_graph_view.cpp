@@ -5,6 +5,7 @@
 #include <float.h>
 #include <poincare/circuit_breaker_checkpoint.h>
 
+#include <algorithm>
 #include <cmath>
 
 using namespace Poincare;
@@ -170,4 +171,14 @@ Ion::Storage::Record FunctionGraphView::initModelBeforeDrawingPlot(
   return record;
 }
 
+KDSize FunctionGraphView::panRedrawnMargin() const {
+  /* Labels are centered on the ticks of the horizontal axis and next to the
+   * vertical axis. */
+  KDSize xLabel = m_xAxis.labelsSize(), yLabel = m_yAxis.labelsSize();
+  return KDSize(std::max<KDCoordinate>(xLabel.width() / 2, yLabel.width()) +
+                    2 * k_labelMargin,
+                std::max<KDCoordinate>(xLabel.height(), yLabel.height() / 2) +
+                    2 * k_labelMargin);
+}
+
 }  // namespace Shared
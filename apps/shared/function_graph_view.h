@@ -61,6 +61,10 @@ class FunctionGraphView
  protected:
   Ion::Storage::Record initModelBeforeDrawingPlot(
       int modelIndex) const override;
+  bool axesFollowPan() const {
+    return m_xAxis.labelsFollowPan() && m_yAxis.labelsFollowPan();
+  }
+  KDSize panRedrawnMargin() const override;
 
   float m_highlightedStart;
   float m_highlightedEnd;
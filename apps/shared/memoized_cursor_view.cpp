@@ -76,7 +76,8 @@ void MemoizedCursorView::redrawCursor(KDRect rect) {
   KDContext* ctx = Ion::Display::Context::SharedContext;
   KDPoint previousOrigin = ctx->origin();
   KDRect previousClippingRect = ctx->clippingRect();
-  redraw(rect);
+  Escher::DirtyRegion redrawnRegion;
+  redraw(rect, &redrawnRegion);
   ctx->setOrigin(previousOrigin);
   ctx->setClippingRect(previousClippingRect);
 }
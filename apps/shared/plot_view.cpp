@@ -6,6 +6,8 @@
 #include <algorithm>
 #include <cmath>
 
+#include "poincare_helpers.h"
+
 using namespace Escher;
 using namespace Poincare;
 
@@ -15,19 +17,67 @@ void AbstractPlotView::reload(bool resetInterruption, bool force,
                               bool forceRedrawAxes) {
   uint32_t rangeVersion = m_range->rangeChecksum();
   bool isReloadNeeded = force || (m_drawnRangeVersion != rangeVersion);
+  const View* banner = bannerView();
+  KDCoordinate bannerHeight = banner ? banner->bounds().height() : 0;
+  KDRect plotRect =
+      KDRect(0, 0, bounds().width(), bounds().height() - bannerHeight);
+  KDRect previousCursorFrame =
+      cursorView() ? relativeChildFrame(cursorView()) : KDRectZero;
+  KDPoint panDelta = KDPointZero;
   if (isReloadNeeded) {
     // FIXME: This should also be called if the *curve* changed
     m_drawnRangeVersion = rangeVersion;
-    const View* banner = bannerView();
-    KDCoordinate bannerHeight = banner ? banner->bounds().height() : 0;
-    markRectAsDirty(
-        KDRect(0, 0, bounds().width(), bounds().height() - bannerHeight));
+    if (!force && !forceRedrawAxes) {
+      panDelta = pixelsPanDelta();
+    }
+    if (panDelta == KDPointZero) {
+      markRectAsDirty(plotRect);
+    }
   }
   layoutSubviews();
+  bool bannerBoundsChanged = m_bannerBoundsChanged;
   if (forceRedrawAxes || isReloadNeeded || m_bannerBoundsChanged) {
     reloadAxes();
     m_bannerBoundsChanged = false;
   }
+  if (panDelta != KDPointZero) {
+    if (bannerBoundsChanged || !willMovePixelsOnPan()) {
+      markRectAsDirty(plotRect);
+      return;
+    }
+    /* The pixels of the cursor moved with the plot, the plot is redrawn where
+     * they landed and where the cursor was. The labels of ticks out of the
+     * range are not drawn, so bands along the edges are redrawn too. The rects
+     * are given before the pan. */
+    KDPoint origin = absoluteOrigin().translatedBy(panDelta.opposite());
+    DirtyRegion staleRegion;
+    staleRegion.add(previousCursorFrame.translatedBy(absoluteOrigin()));
+    staleRegion.add(previousCursorFrame.translatedBy(origin));
+    KDSize margin = panRedrawnMargin();
+    if (panDelta.x() != 0) {
+      staleRegion.add(
+          KDRect(0, 0, margin.width(), plotRect.height()).translatedBy(origin));
+      staleRegion.add(KDRect(plotRect.width() - margin.width(), 0,
+                             margin.width(), plotRect.height())
+                          .translatedBy(origin));
+      addGridLinesNotFollowingPan(OMG::Axis::Horizontal, panDelta.x(),
+                                  margin.width(), plotRect, &staleRegion);
+    }
+    if (panDelta.y() != 0) {
+      staleRegion.add(
+          KDRect(0, 0, plotRect.width(), margin.height()).translatedBy(origin));
+      staleRegion.add(KDRect(0, plotRect.height() - margin.height(),
+                             plotRect.width(), margin.height())
+                          .translatedBy(origin));
+      addGridLinesNotFollowingPan(OMG::Axis::Vertical, panDelta.y(),
+                                  margin.height(), plotRect, &staleRegion);
+    }
+    scrollOwnPixels(plotRect, panDelta, staleRegion);
+    /* The newly exposed pixels are also marked as dirty, for ornaments drawn
+     * incrementally to know that they were redrawn. */
+    markRectAsDirty(plotRect.differencedWith(plotRect.translatedBy(panDelta)));
+    recordDrawnRange();
+  }
 }
 
 void AbstractPlotView::setCursorView(CursorView* cursorView) {
@@ -45,11 +95,74 @@ void AbstractPlotView::setFocus(bool focus) {
 }
 
 void AbstractPlotView::drawRect(KDContext* ctx, KDRect rect) const {
+  recordDrawnRange();
   drawBackground(ctx, rect);
   drawAxesAndGrid(ctx, rect);
   drawPlot(ctx, rect);
 }
 
+KDPoint AbstractPlotView::pixelsPanDelta() const {
+  // Comparisons are written so that a range never drawn, NAN, is not panned
+  float width = pixelWidth(), height = pixelHeight();
+  if (!(std::fabs(width - m_drawnPixelWidth) <=
+            k_panPixelTolerance * width / graphWidth() &&
+        std::fabs(height - m_drawnPixelHeight) <=
+            k_panPixelTolerance * height / graphHeight())) {
+    return KDPointZero;
+  }
+  float dx = (m_drawnXMin - m_range->xMin()) / width;
+  float dy = (m_range->yMax() - m_drawnYMax) / height;
+  float roundedDx = std::round(dx), roundedDy = std::round(dy);
+  if (!(std::fabs(dx - roundedDx) <= k_panPixelTolerance &&
+        std::fabs(dy - roundedDy) <= k_panPixelTolerance &&
+        std::fabs(roundedDx) < bounds().width() &&
+        std::fabs(roundedDy) < bounds().height())) {
+    return KDPointZero;
+  }
+  return KDPoint(roundedDx, roundedDy);
+}
+
+void AbstractPlotView::addGridLinesNotFollowingPan(
+    OMG::Axis axis, KDCoordinate delta, KDCoordinate margin, KDRect plotRect,
+    DirtyRegion* staleRegion) const {
+  /* The pan is a whole number of pixels up to float errors, which can make a
+   * line fall on the other side of a pixel boundary, for instance when it was
+   * drawn on the middle of a pixel. The lines that moved by one pixel more or
+   * less than the pan are redrawn with their labels. */
+  bool horizontal = axis == OMG::Axis::Horizontal;
+  float step = PoincareHelpers::ToFloat(horizontal ? m_range->xGridUnit()
+                                                   : m_range->yGridUnit());
+  float drawnOrigin = horizontal ? m_drawnXMin : m_drawnYMax;
+  float drawnPixel = horizontal ? m_drawnPixelWidth : m_drawnPixelHeight;
+  float shift = std::abs(delta) * pixelLength(axis);
+  int iMin = std::floor((rangeMin(axis) - shift) / step);
+  int iMax = std::ceil((rangeMax(axis) + shift) / step);
+  // The axis at 0 is among the grid lines
+  for (int i = iMin; i <= iMax; i++) {
+    float position = i * step;
+    float drawnPosition = horizontal ? position - drawnOrigin
+                                     : drawnOrigin - position;
+    KDCoordinate drawn = std::round(drawnPosition / drawnPixel);
+    KDCoordinate moved = floatToKDCoordinatePixel(axis, position) - delta;
+    if (drawn == moved) {
+      continue;
+    }
+    KDCoordinate start = std::min(drawn, moved) - margin;
+    KDCoordinate length = std::abs(drawn - moved) + 2 * margin + 1;
+    KDRect band = horizontal ? KDRect(start, 0, length, plotRect.height())
+                             : KDRect(0, start, plotRect.width(), length);
+    staleRegion->add(
+        band.intersectedWith(plotRect).translatedBy(absoluteOrigin()));
+  }
+}
+
+void AbstractPlotView::recordDrawnRange() const {
+  m_drawnXMin = m_range->xMin();
+  m_drawnYMax = m_range->yMax();
+  m_drawnPixelWidth = pixelWidth();
+  m_drawnPixelHeight = pixelHeight();
+}
+
 float AbstractPlotView::floatToFloatPixel(OMG::Axis axis, float f) const {
   float res = axis == OMG::Axis::Horizontal
                   ? (f - m_range->xMin()) / pixelWidth()
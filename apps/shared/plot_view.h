@@ -33,6 +33,10 @@ class AbstractPlotView : public Escher::View {
 
   AbstractPlotView(CurveViewRange* range)
       : m_range(range),
+        m_drawnXMin(NAN),
+        m_drawnYMax(NAN),
+        m_drawnPixelWidth(NAN),
+        m_drawnPixelHeight(NAN),
         m_stampDashIndex(k_stampIndexNoDash),
         m_drawnRangeVersion(0),
         m_bannerOverlapsGraph(true),
@@ -166,6 +170,8 @@ class AbstractPlotView : public Escher::View {
   constexpr static int8_t k_stampDashSize = 5;
   constexpr static int8_t k_stampIndexNoDash = -1;
   constexpr static KDCoordinate k_tickHalfLength = 2;
+  // Tolerance, in pixels, on the float errors of a pan by whole pixels
+  constexpr static float k_panPixelTolerance = 1e-2f;
 
   virtual Escher::View* ornamentView() const { return nullptr; }
   // Escher::View
@@ -184,12 +190,31 @@ class AbstractPlotView : public Escher::View {
   virtual void drawPlot(KDContext* ctx, KDRect rect) const = 0;
   virtual KDRect bannerFrame() = 0;
   virtual void privateSetCursorView(CursorView*) = 0;
+  /* When the range is panned by a whole number of pixels, the pixels already
+   * on display are moved if willMovePixelsOnPan returns true, which it should
+   * only if everything drawn follows the pan. Only the newly exposed pixels,
+   * the cursor and the bands given by panRedrawnMargin are then redrawn. */
+  virtual bool willMovePixelsOnPan() { return false; }
+  /* Width and height of the bands redrawn after the pixels are moved, along
+   * the edges and around the grid lines, for the labels drawn around them. */
+  virtual KDSize panRedrawnMargin() const { return KDSizeZero; }
+  // The move of the pixels drawn with the previous range, if it is a pan
+  KDPoint pixelsPanDelta() const;
+  void addGridLinesNotFollowingPan(OMG::Axis axis, KDCoordinate delta,
+                                   KDCoordinate margin, KDRect plotRect,
+                                   Escher::DirtyRegion* staleRegion) const;
+  void recordDrawnRange() const;
 
   void drawDotOrRing(KDContext* ctx, KDRect rect, Dots::Size size,
                      Poincare::Coordinate2D<float> xy, KDColor color,
                      bool ring) const;
 
   CurveViewRange* m_range;
+  // The range the pixels on display were drawn with
+  mutable float m_drawnXMin;
+  mutable float m_drawnYMax;
+  mutable float m_drawnPixelWidth;
+  mutable float m_drawnPixelHeight;
   mutable int8_t m_stampDashIndex;
   uint32_t m_drawnRangeVersion;
   bool m_bannerOverlapsGraph;
@@ -338,7 +338,12 @@ void AbstractLabeledAxis::reloadAxis(AbstractPlotView* plotView,
   for (size_t labelIndex = 0; labelIndex < n; labelIndex++) {
     computeLabel(labelIndex, plotView, axis);
   }
+  float previousLabelsPosition = m_labelsPosition;
+  AbstractPlotView::RelativePosition previousRelativePosition =
+      m_relativePosition;
   computeLabelsRelativePosition(plotView, axis);
+  m_labelsMoved = m_labelsPosition != previousLabelsPosition ||
+                  m_relativePosition != previousRelativePosition;
 }
 
 int AbstractLabeledAxis::computeLabel(size_t labelIndex,
@@ -413,6 +418,28 @@ void AbstractLabeledAxis::drawLabel(size_t labelIndex, float t,
   }
 }
 
+KDSize AbstractLabeledAxis::labelsSize() const {
+  if (m_hidden) {
+    return KDSizeZero;
+  }
+  return KDSize(labelsMaxWidth(),
+                KDFont::GlyphSize(AbstractPlotView::k_font).height());
+}
+
+KDCoordinate AbstractLabeledAxis::labelsMaxWidth() const {
+  KDCoordinate labelsWidth = 0;
+  size_t n = numberOfLabels();
+  for (size_t labelIndex = 0; labelIndex < n; labelIndex++) {
+    KDCoordinate w = KDFont::Font(AbstractPlotView::k_font)
+                         ->stringSize(label(labelIndex))
+                         .width();
+    if (w > labelsWidth) {
+      labelsWidth = w;
+    }
+  }
+  return labelsWidth;
+}
+
 void AbstractLabeledAxis::computeLabelsRelativePosition(
     const AbstractPlotView* plotView, OMG::Axis axis) const {
   m_labelsPosition = 0.f;
@@ -438,16 +465,7 @@ void AbstractLabeledAxis::computeLabelsRelativePosition(
       m_relativePosition = AbstractPlotView::RelativePosition::After;
     }
   } else {
-    KDCoordinate labelsWidth = 0;
-    size_t n = numberOfLabels();
-    for (size_t labelIndex = 0; labelIndex < n; labelIndex++) {
-      KDCoordinate w = KDFont::Font(AbstractPlotView::k_font)
-                           ->stringSize(label(labelIndex))
-                           .width();
-      if (w > labelsWidth) {
-        labelsWidth = w;
-      }
-    }
+    KDCoordinate labelsWidth = labelsMaxWidth();
     float xMin = plotView->range()->xMin();
     float xMax = plotView->range()->xMax();
     if (xMin + labelsWidth * plotView->pixelWidth() > 0.f) {
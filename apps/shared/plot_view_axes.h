@@ -146,14 +146,25 @@ class AbstractLabeledAxis : public SimpleAxis {
   constexpr static size_t k_maxNumberOfYLabels =
       CurveViewRange::k_maxNumberOfYGridUnits;
 
-  AbstractLabeledAxis() : m_lastDrawnRect(KDRectZero), m_hidden(false) {}
+  AbstractLabeledAxis()
+      : m_labelsPosition(NAN),
+        m_lastDrawnRect(KDRectZero),
+        m_relativePosition(AbstractPlotView::RelativePosition::There),
+        m_hidden(false),
+        m_labelsMoved(true) {}
 
   void reloadAxis(AbstractPlotView* plotView, OMG::Axis axis) override;
   void setOtherAxis(bool other) override { m_otherAxis = other; }
   void setHidden(bool hide) { m_hidden = hide; }
+  /* Labels stuck to an edge of the view do not follow a pan of the range, the
+   * last reload changed their placement. */
+  bool labelsFollowPan() const { return m_hidden || !m_labelsMoved; }
+  // The size of the largest label, or zero if the labels are hidden
+  KDSize labelsSize() const;
 
  protected:
   virtual char* mutableLabel(size_t labelIndex) = 0;
+  KDCoordinate labelsMaxWidth() const;
   const char* label(size_t labelIndex) const {
     assert(labelIndex < numberOfLabels());
     return const_cast<AbstractLabeledAxis*>(this)->mutableLabel(labelIndex);
@@ -174,6 +185,7 @@ class AbstractLabeledAxis : public SimpleAxis {
   mutable AbstractPlotView::RelativePosition m_relativePosition : 2;
   bool m_hidden : 1;
   bool m_otherAxis : 1;
+  bool m_labelsMoved : 1;
 };
 
 template <size_t N>
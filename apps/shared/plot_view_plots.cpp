@@ -115,7 +115,8 @@ WithCurves::CurveDrawing::CurveDrawing(Curve2D curve, void* context,
       m_thick(thick),
       m_dashed(dashed),
       m_patternWithoutCurve(false),
-      m_drawStraightLinesEarly(true) {
+      m_drawStraightLinesEarly(true),
+      m_adaptiveStep(true) {
   assert(std::isfinite(m_tEnd) && std::isfinite(m_tStart));
   // Assert that the chosen step is not too small (ad-hoc value)
   assert((m_tEnd - m_tStart) / m_tStep < 10e5);
@@ -136,10 +137,18 @@ void WithCurves::CurveDrawing::setPatternOptions(
 
 void WithCurves::CurveDrawing::setPrecisionOptions(
     bool drawStraightLinesEarly, Curve2DEvaluation<double> curveDouble,
-    DiscontinuityTest discontinuity) {
+    DiscontinuityTest discontinuity, bool adaptiveStep) {
   m_drawStraightLinesEarly = drawStraightLinesEarly;
   m_curveDouble = curveDouble;
   m_discontinuity = discontinuity;
+  m_adaptiveStep = adaptiveStep;
+}
+
+bool WithCurves::CurveDrawing::canUseAdaptiveStep() const {
+  /* Patterns are drawn at each sample and dashes are counted in stamps, so
+   * both rely on the step given by the caller. */
+  return m_adaptiveStep && m_drawStraightLinesEarly && !m_dashed &&
+         !m_patternLowerBound && !m_patternUpperBound;
 }
 
 void WithCurves::CurveDrawing::draw(const AbstractPlotView* plotView,
@@ -153,12 +162,17 @@ void WithCurves::CurveDrawing::draw(const AbstractPlotView* plotView,
 
   float previousT = NAN, t = NAN;
   Coordinate2D<float> previousXY, xy;
+  /* Pixel positions of the two previous samples, taken with the current step.
+   * They are forgotten whenever the step changes. */
+  Coordinate2D<float> p0, p1;
+  bool adaptiveStep = canUseAdaptiveStep();
+  int stepLevel = 0;
   int i = 0;
   bool isLastSegment = false;
 
   do {
     previousT = t;
-    t = m_tStart + (i++) * m_tStep;
+    t = m_tStart + i * m_tStep;
     if (t <= m_tStart) {
       t = m_tStart + FLT_EPSILON;
     }
@@ -168,12 +182,44 @@ void WithCurves::CurveDrawing::draw(const AbstractPlotView* plotView,
     }
     if (previousT == t) {
       // No need to draw segment. Happens when tStep << tStart .
+      i++;
       continue;
     }
     previousXY = xy;
     xy = m_curve.evaluate(t, m_context);
-    joinDots(plotView, ctx, rect, previousT, previousXY, t, xy,
-             k_maxNumberOfIterations, m_discontinuity);
+    bool drawnWithoutSubdivision =
+        joinDots(plotView, ctx, rect, previousT, previousXY, t, xy,
+                 k_maxNumberOfIterations + stepLevel, m_discontinuity);
+    if (adaptiveStep) {
+      Coordinate2D<float> p2 = plotView->floatToPixel2D(xy);
+      int previousStepLevel = stepLevel;
+      if (!drawnWithoutSubdivision || !std::isfinite(p2.x()) ||
+          !std::isfinite(p2.y())) {
+        stepLevel = 0;
+      } else if (std::isfinite(p0.x()) && std::isfinite(p0.y())) {
+        /* The second difference is the deviation of the middle sample from
+         * the chord of the two others, times two. Doubling the step roughly
+         * multiplies it by four. */
+        float deviation =
+            std::max(std::fabs(p2.x() - 2.f * p1.x() + p0.x()),
+                     std::fabs(p2.y() - 2.f * p1.y() + p0.y()));
+        if (deviation > 2.f * k_maxChordDeviation) {
+          stepLevel = std::max(stepLevel - 1, 0);
+        } else if (deviation < 0.5f * k_maxChordDeviation &&
+                   stepLevel < k_maxStepLevel &&
+                   i % (2 << stepLevel) == 0) {
+          // Only grow on aligned indexes, to keep samples on the same grid
+          stepLevel++;
+        }
+      }
+      if (stepLevel != previousStepLevel) {
+        p0 = Coordinate2D<float>();
+      } else {
+        p0 = p1;
+      }
+      p1 = p2;
+    }
+    i += 1 << stepLevel;
   } while (!isLastSegment);
 
   plotView->setDashed(false);
@@ -187,7 +233,14 @@ static bool pointInBoundingBox(float x1, float y1, float x2, float y2, float xC,
           (y2 == yC && yC == y1));
 }
 
-void WithCurves::CurveDrawing::joinDots(const AbstractPlotView* plotView,
+static float distanceToChordMiddle(Coordinate2D<float> p1,
+                                   Coordinate2D<float> p2,
+                                   Coordinate2D<float> p12) {
+  return std::max(std::fabs(p12.x() - 0.5f * (p1.x() + p2.x())),
+                  std::fabs(p12.y() - 0.5f * (p1.y() + p2.y())));
+}
+
+bool WithCurves::CurveDrawing::joinDots(const AbstractPlotView* plotView,
                                         KDContext* ctx, KDRect rect, float t1,
                                         Coordinate2D<float> xy1, float t2,
                                         Coordinate2D<float> xy2,
@@ -201,7 +254,7 @@ void WithCurves::CurveDrawing::joinDots(const AbstractPlotView* plotView,
   bool isRightDotValid = std::isfinite(xy2.x()) && std::isfinite(xy2.y());
 
   if (!(isLeftDotValid || isRightDotValid)) {
-    return;
+    return false;
   }
 
   Coordinate2D<float> p1 = plotView->floatToPixel2D(xy1);
@@ -220,12 +273,13 @@ void WithCurves::CurveDrawing::joinDots(const AbstractPlotView* plotView,
                                 .y()) < pixelTolerance)) {
       plotView->stamp(ctx, rect, p2, m_color, m_thick);
     }
-    return;
+    return true;
   }
 
   float t12 = 0.5f * (t1 + t2);
   Coordinate2D<float> xy12 = m_curve.evaluate(t12, m_context);
 
+  Coordinate2D<float> p12 = plotView->floatToPixel2D(xy12);
   bool discontinuous = discontinuity(t1, t2, m_curve.model(), m_context);
   if (discontinuous) {
     /* If the function is discontinuous, it can never join dots at abscissas of
@@ -234,14 +288,13 @@ void WithCurves::CurveDrawing::joinDots(const AbstractPlotView* plotView,
      * dots left and right of the discontinuity is on the same pixel as the
      * middle dot, we are close enough of the discontinuity and we can stop
      * drawing more precisely. */
-    Coordinate2D<float> p12 = plotView->floatToPixel2D(xy12);
     if (isRightDotValid && (plotView->pointsInSameStamp(p1, p12, m_thick) ||
                             plotView->pointsInSameStamp(p12, p2, m_thick))) {
       plotView->stamp(ctx, rect, p2, m_color, m_thick);
-      return;
+      return false;
     }
   } else if (isLeftDotValid && isRightDotValid &&
-             (m_drawStraightLinesEarly || remainingIterations <= 0) &&
+             canDrawStraightLine(t1, p1, t2, p2, p12, remainingIterations) &&
              pointInBoundingBox(xy1.x(), xy1.y(), xy2.x(), xy2.y(), xy12.x(),
                                 xy12.y())) {
     /* As the middle dot is between the two dots, we assume that we
@@ -269,12 +322,12 @@ void WithCurves::CurveDrawing::joinDots(const AbstractPlotView* plotView,
     if (straightJoinDots) {
       drawPattern(plotView, ctx, rect, t12, xy12);
       plotView->straightJoinDots(ctx, rect, p1, p2, m_color, m_thick);
-      return;
+      return true;
     }
   }
 
   if (remainingIterations <= 0) {
-    return;
+    return false;
   }
   remainingIterations--;
 
@@ -305,6 +358,27 @@ void WithCurves::CurveDrawing::joinDots(const AbstractPlotView* plotView,
            discontinuous ? m_discontinuity : NoDiscontinuity);
   joinDots(plotView, ctx, rect, t12, xy12, t2, xy2, remainingIterations,
            discontinuous ? m_discontinuity : NoDiscontinuity);
+  return false;
+}
+
+bool WithCurves::CurveDrawing::canDrawStraightLine(
+    float t1, Coordinate2D<float> p1, float t2, Coordinate2D<float> p2,
+    Coordinate2D<float> p12, int remainingIterations) const {
+  if (m_drawStraightLinesEarly) {
+    /* Segments spanning the caller's step are drawn straight right away, as
+     * they have always been. Longer segments come from the adaptive step and
+     * must follow their chord. */
+    return std::fabs(t2 - t1) < 1.5f * m_tStep ||
+           distanceToChordMiddle(p1, p2, p12) < k_maxChordDeviation;
+  }
+  if (remainingIterations <= 0) {
+    return true;
+  }
+  float dx = p2.x() - p1.x();
+  float dy = p2.y() - p1.y();
+  return m_adaptiveStep &&
+         dx * dx + dy * dy <= k_maxShortChordLength * k_maxShortChordLength &&
+         distanceToChordMiddle(p1, p2, p12) < k_maxChordDeviation;
 }
 
 void WithCurves::CurveDrawing::drawPattern(
@@ -90,9 +90,12 @@ class WithCurves {
                            float patternEnd, Curve2D patternLowerBound,
                            Curve2D patternUpperBound, bool patternWithoutCurve,
                            OMG::Axis axis = OMG::Axis::Horizontal);
+    /* With adaptiveStep, the parts of the curve that are almost straight are
+     * sampled less densely, to save evaluations. */
     void setPrecisionOptions(bool drawStraightLinesEarly,
                              Curve2DEvaluation<double> curveDouble,
-                             DiscontinuityTest discontinuity);
+                             DiscontinuityTest discontinuity,
+                             bool adaptiveStep = true);
     void draw(const AbstractPlotView* plotView, KDContext* ctx,
               KDRect rect) const;
 
@@ -104,11 +107,28 @@ class WithCurves {
      * screen though.
      */
     constexpr static int k_maxNumberOfIterations = 8;
-
-    void joinDots(const AbstractPlotView* plotView, KDContext* ctx, KDRect rect,
+    /* Where the curve is close to a straight line, the sampling step is
+     * doubled, up to 2^k_maxStepLevel times the step given by the caller.
+     * The curvature is estimated in pixels with the second difference of the
+     * last three samples. A coarse segment is only drawn as a straight line if
+     * its middle dot lies within k_maxChordDeviation pixels of the chord. */
+    constexpr static int k_maxStepLevel = 3;
+    constexpr static float k_maxChordDeviation = 0.25f;
+    /* Curves that are not drawn with straight lines early, such as parametric
+     * curves, may still be joined by a straight line on chords shorter than
+     * this length in pixels. */
+    constexpr static float k_maxShortChordLength = 4.f;
+
+    bool canUseAdaptiveStep() const;
+    /* Return true if the segment has been drawn without being subdivided. */
+    bool joinDots(const AbstractPlotView* plotView, KDContext* ctx, KDRect rect,
                   float t1, Poincare::Coordinate2D<float> xy1, float t2,
                   Poincare::Coordinate2D<float> xy2, int remainingIterations,
                   DiscontinuityTest discontinuity) const;
+    bool canDrawStraightLine(float t1, Poincare::Coordinate2D<float> p1,
+                             float t2, Poincare::Coordinate2D<float> p2,
+                             Poincare::Coordinate2D<float> p12,
+                             int remainingIterations) const;
     void drawPattern(const AbstractPlotView* plotView, KDContext* ctx,
                      KDRect rect, float t,
                      Poincare::Coordinate2D<float> xy) const;
@@ -131,6 +151,7 @@ class WithCurves {
     bool m_dashed;
     bool m_patternWithoutCurve;
     bool m_drawStraightLinesEarly;
+    bool m_adaptiveStep;
   };
 
   // Methods for drawing special curves
@@ -3,6 +3,8 @@
 #include <assert.h>
 #include <omg/signaling_nan.h>
 
+#include <algorithm>
+
 #include "sequence_store.h"
 
 namespace Shared {
@@ -36,6 +38,62 @@ void SequenceCache::resetComputationStatus() {
   }
 }
 
+void SequenceCache::resetCheckpointsOfSequence(int sequenceIndex) {
+  assert(0 <= sequenceIndex && sequenceIndex < k_numberOfSequences);
+  for (int i = 0; i < k_numberOfCheckpoints; i++) {
+    for (int depth = 0; depth < k_checkpointDepth; depth++) {
+      m_checkpoints[sequenceIndex][i][depth] = OMG::SignalingNan<double>();
+    }
+  }
+}
+
+void SequenceCache::storeCheckpoint(int sequenceIndex,
+                                    bool intermediateComputation) {
+  int offset = rank(sequenceIndex, intermediateComputation) -
+               sequenceAtNameIndex(sequenceIndex)->initialRank();
+  int index = offset / k_checkpointInterval - 1;
+  if (offset % k_checkpointInterval != 0 || index < 0 ||
+      index >= k_numberOfCheckpoints) {
+    return;
+  }
+  double* values = valuesPointer(sequenceIndex, intermediateComputation);
+  for (int depth = 0; depth < k_checkpointDepth; depth++) {
+    if (OMG::IsSignalingNan(values[depth])) {
+      return;
+    }
+  }
+  for (int depth = 0; depth < k_checkpointDepth; depth++) {
+    m_checkpoints[sequenceIndex][index][depth] = values[depth];
+  }
+}
+
+bool SequenceCache::restoreCheckpoint(int sequenceIndex,
+                                      bool intermediateComputation, int rank) {
+  int initialRank = sequenceAtNameIndex(sequenceIndex)->initialRank();
+  int* currentRank = rankPointer(sequenceIndex, intermediateComputation);
+  int index = std::min((rank - initialRank) / k_checkpointInterval,
+                       k_numberOfCheckpoints) -
+              1;
+  for (; index >= 0; index--) {
+    int checkpointRank = initialRank + (index + 1) * k_checkpointInterval;
+    if (checkpointRank <= *currentRank) {
+      // Stepping from the current rank is shorter
+      return false;
+    }
+    if (OMG::IsSignalingNan(m_checkpoints[sequenceIndex][index][0])) {
+      continue;
+    }
+    *currentRank = checkpointRank;
+    resetValuesOfSequence(sequenceIndex, intermediateComputation);
+    double* values = valuesPointer(sequenceIndex, intermediateComputation);
+    for (int depth = 0; depth < k_checkpointDepth; depth++) {
+      values[depth] = m_checkpoints[sequenceIndex][index][depth];
+    }
+    return true;
+  }
+  return false;
+}
+
 double SequenceCache::storedValueOfSequenceAtRank(int sequenceIndex, int rank) {
   assert(0 <= sequenceIndex && sequenceIndex < k_numberOfSequences);
   for (int loop = 0; loop < 3; loop++) {
@@ -113,6 +171,9 @@ void SequenceCache::stepUntilRank(int sequenceIndex, int rank,
   if (*currentRank > rank) {
     resetRanksAndValuesOfSequence(sequenceIndex, intermediateComputation);
   }
+  if (!jumpToRank) {
+    restoreCheckpoint(sequenceIndex, intermediateComputation, rank);
+  }
   while (*currentRank < rank) {
     int step = jumpToRank ? rank - *currentRank : 1;
     stepRanks(sequenceIndex, intermediateComputation, step, ctx);
@@ -162,6 +223,7 @@ void SequenceCache::stepRanks(int sequenceIndex, bool intermediateComputation,
       m_initialValues[sequenceIndex][offset] = *values;
     }
   }
+  storeCheckpoint(sequenceIndex, intermediateComputation);
 
   // Update computation state
   if (!intermediateComputation) {
@@ -176,6 +238,7 @@ void SequenceCache::resetCache() {
     for (int j = 0; j < k_storageDepth; ++j) {
       m_initialValues[i][j] = OMG::SignalingNan<double>();
     }
+    resetCheckpointsOfSequence(i);
   }
   resetComputationStatus();
   for (int i = 0; i < k_numberOfSequences; i++) {
@@ -27,6 +27,11 @@ class SequenceCache {
   constexpr static int k_storageDepth = 6;
   constexpr static int k_numberOfSequences = 3;
   // SequenceStore::k_maxNumberOfSequences;
+  constexpr static int k_checkpointInterval = 256;
+  constexpr static int k_numberOfCheckpoints =
+      k_maxRecurrentRank / k_checkpointInterval;
+  constexpr static int k_checkpointDepth = 2;
+  // SequenceStore::k_maxRecurrenceDepth;
 
   int* rankPointer(int sequenceIndex, bool intermediateComputation);
   double* valuesPointer(int sequenceIndex, bool intermediateComputation);
@@ -38,6 +43,12 @@ class SequenceCache {
   void resetRanksAndValuesOfSequence(int sequenceIndex,
                                      bool intermediateComputation);
   void resetComputationStatus();
+  void resetCheckpointsOfSequence(int sequenceIndex);
+  void storeCheckpoint(int sequenceIndex, bool intermediateComputation);
+  /* Move to the highest checkpoint in ]currentRank, rank]. Return false if
+   * there is none. */
+  bool restoreCheckpoint(int sequenceIndex, bool intermediateComputation,
+                         int rank);
   const Shared::Sequence* sequenceAtNameIndex(int sequenceIndex) const;
   int rankForInitialValuesStorage(int sequenceIndex) const;
 
@@ -53,6 +64,12 @@ class SequenceCache {
    * always step to rank n and then step back to rank 0, replacing all values
    * stored in m_intermediateValues. */
   double m_initialValues[k_numberOfSequences][k_storageDepth];
+  /* Save the values every k_checkpointInterval ranks, so that reaching a rank
+   * steps from the closest checkpoint below it instead of the initial rank.
+   * For a sequence u with initial rank i, m_checkpoints[u][c] holds
+   * {u(r), u(r-1)} with r = i + (c+1) * k_checkpointInterval. */
+  double m_checkpoints[k_numberOfSequences][k_numberOfCheckpoints]
+                      [k_checkpointDepth];
 
   bool m_isInsideComputation;
   int m_smallestRankBeingComputed[k_numberOfSequences];
@@ -0,0 +1,221 @@
+#include <poincare/print.h>
+#include <quiz.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "../plot_view.h"
+#include "../plot_view_axes.h"
+#include "../plot_view_banners.h"
+#include "../plot_view_cursors.h"
+#include "../plot_view_plots.h"
+
+using namespace Poincare;
+
+namespace Shared {
+
+constexpr KDCoordinate k_width = 321;
+constexpr KDCoordinate k_height = 241;
+
+class BufferContext : public KDContext {
+ public:
+  BufferContext()
+      : KDContext(KDPointZero, KDRect(0, 0, k_width, k_height)) {}
+  void clear() {
+    pushRectUniform(KDRect(0, 0, k_width, k_height), KDColorWhite);
+  }
+  KDColor pixel(KDCoordinate x, KDCoordinate y) const {
+    return m_pixels[y * k_width + x];
+  }
+
+ private:
+  void pushRect(KDRect rect, const KDColor* pixels) override {
+    for (KDCoordinate j = 0; j < rect.height(); j++) {
+      for (KDCoordinate i = 0; i < rect.width(); i++) {
+        m_pixels[(rect.top() + j) * k_width + rect.left() + i] =
+            pixels[j * rect.width() + i];
+      }
+    }
+  }
+  void pushRectUniform(KDRect rect, KDColor color) override {
+    for (KDCoordinate j = 0; j < rect.height(); j++) {
+      for (KDCoordinate i = 0; i < rect.width(); i++) {
+        m_pixels[(rect.top() + j) * k_width + rect.left() + i] = color;
+      }
+    }
+  }
+  void pullRect(KDRect rect, KDColor* pixels) override {
+    for (KDCoordinate j = 0; j < rect.height(); j++) {
+      for (KDCoordinate i = 0; i < rect.width(); i++) {
+        pixels[j * rect.width() + i] =
+            m_pixels[(rect.top() + j) * k_width + rect.left() + i];
+      }
+    }
+  }
+
+  KDColor m_pixels[k_width * k_height];
+};
+
+class FixedRange : public CurveViewRange {
+ public:
+  FixedRange(float xMin, float xMax, float yMin, float yMax)
+      : m_xMin(xMin), m_xMax(xMax), m_yMin(yMin), m_yMax(yMax) {}
+  float xMin() const override { return m_xMin; }
+  float xMax() const override { return m_xMax; }
+  float yMin() const override { return m_yMin; }
+  float yMax() const override { return m_yMax; }
+
+ private:
+  float m_xMin, m_xMax, m_yMin, m_yMax;
+};
+
+typedef float (*CurveFunction)(float);
+
+struct SampledCurve {
+  const char* name;
+  CurveFunction x;
+  CurveFunction y;
+  float tMin;
+  float tMax;
+};
+
+static int s_numberOfEvaluations = 0;
+
+class CountingPlotPolicy : public PlotPolicy::WithCurves {
+ public:
+  void setCurve(const SampledCurve* curve, bool adaptiveStep) {
+    m_curve = curve;
+    m_adaptiveStep = adaptiveStep;
+  }
+
+ protected:
+  void drawPlot(const AbstractPlotView* plotView, KDContext* ctx,
+                KDRect rect) const {
+    /* Cartesian curves are sampled every pixel and parametric curves use the
+     * step of the graph app. */
+    bool cartesian = m_curve->x == nullptr;
+    float tStep =
+        cartesian ? plotView->pixelWidth() : (m_curve->tMax - m_curve->tMin) /
+                                                 80.0938275501223f;
+    CurveDrawing plot(Curve2D(Evaluate, const_cast<SampledCurve*>(m_curve)),
+                      nullptr, m_curve->tMin, m_curve->tMax, tStep,
+                      KDColorRed);
+    plot.setPrecisionOptions(cartesian, nullptr, NoDiscontinuity,
+                             m_adaptiveStep);
+    plot.draw(plotView, ctx, rect);
+  }
+
+ private:
+  static Coordinate2D<float> Evaluate(float t, void* model, void*) {
+    s_numberOfEvaluations++;
+    const SampledCurve* curve = static_cast<const SampledCurve*>(model);
+    return Coordinate2D<float>(curve->x ? curve->x(t) : t, curve->y(t));
+  }
+
+  const SampledCurve* m_curve;
+  bool m_adaptiveStep;
+};
+
+class CountingPlotView
+    : public PlotView<PlotPolicy::NoAxes, CountingPlotPolicy,
+                      PlotPolicy::NoBanner, PlotPolicy::NoCursor> {
+ public:
+  using PlotView::PlotView;
+};
+
+static float identity(float t) { return t; }
+
+const SampledCurve k_curves[] = {
+    {"3", nullptr, [](float) { return 3.f; }, -10.f, 10.f},
+    {"x/2", nullptr, [](float t) { return t / 2.f; }, -10.f, 10.f},
+    {"x^2/4", nullptr, [](float t) { return t * t / 4.f; }, -10.f, 10.f},
+    {"x^3/20-x", nullptr, [](float t) { return t * t * t / 20.f - t; }, -10.f,
+     10.f},
+    {"3sin(x)", nullptr, [](float t) { return 3.f * std::sin(t); }, -10.f,
+     10.f},
+    {"sin(3x)+cos(x)", nullptr,
+     [](float t) { return std::sin(3.f * t) + std::cos(t); }, -10.f, 10.f},
+    {"e^x", nullptr, [](float t) { return std::exp(t); }, -10.f, 10.f},
+    {"ln(x)", nullptr, [](float t) { return std::log(t); }, -10.f, 10.f},
+    {"√(x)", nullptr, [](float t) { return std::sqrt(t); }, -10.f, 10.f},
+    {"1/x", nullptr, [](float t) { return 1.f / t; }, -10.f, 10.f},
+    {"tan(x)", nullptr, [](float t) { return std::tan(t); }, -10.f, 10.f},
+    {"|x|-2", nullptr, [](float t) { return std::fabs(t) - 2.f; }, -10.f,
+     10.f},
+    {"(5cos(t),5sin(t))", [](float t) { return 5.f * std::cos(t); },
+     [](float t) { return 5.f * std::sin(t); }, 0.f, 6.2831853f},
+    {"(t,t^2/8)", identity, [](float t) { return t * t / 8.f; }, -10.f, 10.f},
+    {"(6cos(3t),6sin(2t))", [](float t) { return 6.f * std::cos(3.f * t); },
+     [](float t) { return 6.f * std::sin(2.f * t); }, 0.f, 6.2831853f},
+};
+
+static int drawCurve(const SampledCurve* curve, bool adaptiveStep,
+                     BufferContext* ctx) {
+  FixedRange range(-10.f, 10.f, -7.5f, 7.5f);
+  CountingPlotView view(&range);
+  view.setSize(KDSize(k_width, k_height));
+  view.setCurve(curve, adaptiveStep);
+  ctx->clear();
+  s_numberOfEvaluations = 0;
+  view.drawRect(ctx, view.bounds());
+  return s_numberOfEvaluations;
+}
+
+/* Stamps are antialiased and placed along chords, so both drawings cannot be
+ * compared pixel per pixel. Instead, each well inked pixel of a drawing must
+ * be next to a well inked pixel of the other one. The green component goes
+ * from 255 on the white background to 0 on the red curve. */
+static bool isInked(const BufferContext& ctx, KDCoordinate x, KDCoordinate y) {
+  return ctx.pixel(x, y).green() < 128;
+}
+
+static int numberOfMisplacedPixels(const BufferContext& drawing,
+                                   const BufferContext& reference) {
+  int result = 0;
+  for (KDCoordinate y = 0; y < k_height; y++) {
+    for (KDCoordinate x = 0; x < k_width; x++) {
+      if (!isInked(drawing, x, y)) {
+        continue;
+      }
+      bool hasInkedNeighbour = false;
+      for (KDCoordinate j = std::max(y - 1, 0);
+           j <= std::min(y + 1, k_height - 1); j++) {
+        for (KDCoordinate i = std::max(x - 1, 0);
+             i <= std::min(x + 1, k_width - 1); i++) {
+          hasInkedNeighbour = hasInkedNeighbour || isInked(reference, i, j);
+        }
+      }
+      result += !hasInkedNeighbour;
+    }
+  }
+  return result;
+}
+
+QUIZ_CASE(shared_curve_drawing_adaptive_step) {
+  constexpr size_t k_bufferSize = 100;
+  char buffer[k_bufferSize];
+  int totalFixed = 0, totalAdaptive = 0;
+  for (const SampledCurve& curve : k_curves) {
+    // Static to spare the stack
+    static BufferContext fixedContext, adaptiveContext;
+    int fixedEvaluations = drawCurve(&curve, false, &fixedContext);
+    int adaptiveEvaluations = drawCurve(&curve, true, &adaptiveContext);
+    int misplacedPixels =
+        numberOfMisplacedPixels(fixedContext, adaptiveContext) +
+        numberOfMisplacedPixels(adaptiveContext, fixedContext);
+    Print::CustomPrintf(buffer, k_bufferSize,
+                        "  %s: %i evaluations, %i adaptive", curve.name,
+                        fixedEvaluations, adaptiveEvaluations);
+    quiz_print(buffer);
+    quiz_assert(adaptiveEvaluations <= fixedEvaluations);
+    quiz_assert(misplacedPixels == 0);
+    totalFixed += fixedEvaluations;
+    totalAdaptive += adaptiveEvaluations;
+  }
+  Print::CustomPrintf(buffer, k_bufferSize,
+                      "  total: %i evaluations, %i adaptive", totalFixed,
+                      totalAdaptive);
+  quiz_print(buffer);
+}
+
+}  // namespace Shared
@@ -3,6 +3,7 @@
 
 #include <escher/editable_field_help_box.h>
 #include <escher/i18n.h>
+#include <escher/idle_job.h>
 #include <escher/image.h>
 #include <escher/modal_view_controller.h>
 #include <escher/responder.h>
@@ -93,6 +94,11 @@ class App : public Responder {
     assert(false);
     return nullptr;
   }
+  virtual int numberOfIdleJobs() { return 0; }
+  virtual IdleJob* idleJobAtIndex(int i) {
+    assert(false);
+    return nullptr;
+  }
   virtual Poincare::Context* localContext() { return nullptr; }
   virtual EditableFieldHelpBox* toolbox() { return nullptr; }
   virtual EditableFieldHelpBox* variableBox() { return nullptr; }
@@ -39,6 +39,8 @@ class Container : public RunLoop {
  private:
   int numberOfTimers() override;
   Timer* timerAtIndex(int i) override;
+  int numberOfIdleJobs() override;
+  IdleJob* idleJobAtIndex(int i) override;
   virtual int numberOfContainerTimers();
   virtual Timer* containerTimerAtIndex(int i);
   static App* s_activeApp;
@@ -0,0 +1,41 @@
+#ifndef ESCHER_DIRTY_REGION_H
+#define ESCHER_DIRTY_REGION_H
+
+#include <kandinsky/rect.h>
+#include <stdint.h>
+
+namespace Escher {
+
+/* A DirtyRegion is a union of a few disjoint rectangles. Unlike a single
+ * bounding rectangle, it keeps distant areas apart so that redrawing both a
+ * status bar icon and a text cursor does not redraw everything in between.
+ * Intersecting rectangles are merged, so that no pixel is drawn twice. When the
+ * region is full, the two rectangles whose union wastes the fewest pixels are
+ * merged, so the region always covers every rectangle that was added. */
+
+class DirtyRegion {
+ public:
+  constexpr static int k_maxNumberOfRects = 4;
+
+  constexpr DirtyRegion() : m_numberOfRects(0) {}
+
+  int numberOfRects() const { return m_numberOfRects; }
+  KDRect rectAtIndex(int index) const;
+  bool isEmpty() const { return m_numberOfRects == 0; }
+
+  void add(KDRect rect);
+
+ private:
+  // Pixels in the union of a and b that are neither in a nor in b
+  static int32_t WastedArea(KDRect a, KDRect b);
+  void removeRectAtIndex(int index);
+
+  // KDRect has no default constructor, the unused rectangles are zero
+  KDRect m_rects[k_maxNumberOfRects] = {KDRectZero, KDRectZero, KDRectZero,
+                                        KDRectZero};
+  uint8_t m_numberOfRects;
+};
+
+}  // namespace Escher
+
+#endif
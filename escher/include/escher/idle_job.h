@@ -0,0 +1,58 @@
+#ifndef ESCHER_IDLE_JOB_H
+#define ESCHER_IDLE_JOB_H
+
+#include <stdint.h>
+
+namespace Escher {
+
+/* An IdleJob is some work that can be done in advance, which the run loop
+ * resumes while there is no event to process. Its result is then often ready
+ * before the user asks for it.
+ *
+ * The run loop calls work repeatedly, in time slices, on the pending job with
+ * the highest priority. A slice should last a few milliseconds at most, and
+ * should be interrupted by a key press when it can last longer, so that the
+ * next event is not delayed. The job marks as dirty the views it changes, the
+ * run loop redraws them after each slice. */
+
+class IdleJob {
+ public:
+  enum class Priority : uint8_t { Low, Normal, High };
+
+  IdleJob(Priority priority = Priority::Normal)
+      : m_priority(priority),
+        m_pendingSince(k_notPending),
+        m_lastLatency(0),
+        m_workDuration(0),
+        m_numberOfSlices(0) {}
+
+  Priority priority() const { return m_priority; }
+  virtual bool hasPendingWork() = 0;
+  /* Do a slice of work. Return false if a key press interrupted it, in which
+   * case the run loop handles the event before resuming the job. */
+  bool run();
+
+  /* Statistics: the latency is the time between the moment the run loop saw
+   * the job pending and the moment it saw it done. The work duration and the
+   * number of slices are those of the work done in idle time. */
+  bool updatePendingStatus(uint64_t time);
+  uint32_t lastLatency() const { return m_lastLatency; }
+  uint32_t workDuration() const { return m_workDuration; }
+  uint32_t numberOfSlices() const { return m_numberOfSlices; }
+
+ protected:
+  virtual bool work() = 0;
+
+ private:
+  constexpr static uint64_t k_notPending = UINT64_MAX;
+
+  Priority m_priority;
+  uint64_t m_pendingSince;
+  uint32_t m_lastLatency;
+  uint32_t m_workDuration;
+  uint32_t m_numberOfSlices;
+};
+
+}  // namespace Escher
+
+#endif
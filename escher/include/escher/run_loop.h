@@ -1,6 +1,7 @@
 #ifndef ESCHER_RUN_LOOP_H
 #define ESCHER_RUN_LOOP_H
 
+#include <escher/idle_job.h>
 #include <escher/timer.h>
 #include <ion.h>
 
@@ -16,12 +17,26 @@ class RunLoop {
   virtual bool dispatchEvent(Ion::Events::Event e) = 0;
   virtual int numberOfTimers();
   virtual Timer* timerAtIndex(int i);
+  virtual int numberOfIdleJobs();
+  virtual IdleJob* idleJobAtIndex(int i);
   virtual void listenToExternalEvents() = 0;
 
  private:
   // Returns true while the Termination event is not fired.
   bool step();
+  void didSpendTime(int duration);
+  // Return the pending idle job with the highest priority, if any
+  IdleJob* pendingIdleJob();
+  void runIdleJob(IdleJob* job);
+
+  /* Idle jobs are given at most this duration per step, so that timers keep
+   * firing while they run. */
+  constexpr static int k_idleStepDuration = 50;  // In milliseconds
+
   int m_time;
+  /* True while no event has been received during the last step. Idle jobs
+   * only run in that case, and stop at the first key press. */
+  bool m_idle;
   /* When the Termination event is fired in a run loop, this bool is set to
    * true so that all parent run loops are stopped. */
   bool m_breakAllLoops;
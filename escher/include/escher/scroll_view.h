@@ -156,6 +156,8 @@ class ScrollView : public View {
   };
 
   KDRect layoutDecorator(bool force);
+  // Absolute rect of the pixels moved when the content scrolls
+  KDRect scrollablePixelsRect();
   KDRect visibleContentRect();
   KDRect visibleRectInBounds() {
     return m_scrollViewDelegate
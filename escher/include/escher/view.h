@@ -1,6 +1,7 @@
 #ifndef ESCHER_VIEW_H
 #define ESCHER_VIEW_H
 
+#include <escher/dirty_region.h>
 #include <kandinsky/context.h>
 #include <kandinsky/point.h>
 #include <kandinsky/rect.h>
@@ -73,7 +74,7 @@ class View {
    * bound to a view, it's really absolute pixels that count.
    *
    * That being said, what are the case of dirtyness that we know of?
-   *  - Scrolling -> well, everything has to be redrawn anyway
+   *  - Scrolling -> the pixels on display can be moved, see willScrollPixels
    *  - Moving a cursor -> In that case, there's really a much more efficient
    * way
    *  - ... and that's all I can think of.
@@ -82,6 +83,22 @@ class View {
   void markAbsoluteRectAsDirty(KDRect rect);
   // Doing this is equivalent to markAbsoluteRectAsDirty(m_frame) but faster
   void markWholeFrameAsDirty() { m_dirtyRect = m_frame; }
+  /* Scrolling moves the pixels already on display instead of redrawing them.
+   * willScrollPixels collects into staleRegion the dirty rectangles of the
+   * view that do not move with movedView, a subview. Until didScrollPixels,
+   * movedView is then translated by setFrame without being marked as dirty,
+   * its dirty rectangles moving along. At next redraw, the pixels of the
+   * absolute rect are moved by delta on the display, and only the newly
+   * exposed part of rect and the moved staleRegion are redrawn. */
+  void willScrollPixels(View* movedView, DirtyRegion* staleRegion);
+  void didScrollPixels(View* movedView, KDRect rect, KDPoint delta,
+                       const DirtyRegion& staleRegion);
+  /* A view can also move the pixels it draws itself, when what it displays is
+   * panned. The pixels of rect, relative to the view, are moved by delta.
+   * staleRegion holds the absolute rectangles, before the pan, that do not
+   * follow it, to which the dirty rectangles of the view and its subviews are
+   * added. */
+  void scrollOwnPixels(KDRect rect, KDPoint delta, DirtyRegion staleRegion);
 
 #if ESCHER_VIEW_LOGGING
   virtual const char* className() const;
@@ -94,7 +111,30 @@ class View {
   void setFrame(KDRect frame, bool force);
   virtual void layoutSubviews(bool force = false) {}
   void translate(KDPoint origin);
-  KDRect redraw(KDRect rect, KDRect forceRedrawRect = KDRectZero);
+  void redraw(KDRect rect, DirtyRegion* redrawnRegion);
+  /* Add the dirty rectangles of the view and its subviews to region, except
+   * for excludedView and its subviews. */
+  void addDirtyRectsToRegion(DirtyRegion* region, const View* excludedView);
+
+  /* A single scroll is pending at a time, its pixels are moved when its view
+   * is redrawn. */
+  struct PendingScroll {
+    View* view;
+    KDRect rect;
+    KDPoint delta;
+    DirtyRegion staleRegion;
+  };
+  static PendingScroll s_pendingScroll;
+  // The view translated between willScrollPixels and didScrollPixels
+  static View* s_movedView;
+  /* The scroll is cancelled if its view is not in the hierarchy of root, or if
+   * a view drawn after it overlaps its rect. */
+  static void ValidatePendingScroll(View* root);
+  bool allowsPendingScroll(bool* foundScrollView);
+  static void CancelPendingScroll();
+  void addPendingScroll(KDRect rect, KDPoint delta,
+                        const DirtyRegion& staleRegion);
+  void performPendingScroll(KDRect visibleRect, DirtyRegion* redrawnRegion);
 
   /* At destruction, subviews aren't notified that their own pointer
    * 'm_superview' is outdated. This is not an issue since all view hierarchy
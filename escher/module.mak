@@ -16,6 +16,7 @@ $(call create_module,escher,1,$(addprefix src/, \
   chevron_view.cpp \
   clipboard.cpp \
   container.cpp \
+  dirty_region.cpp \
   dropdown_view.cpp \
   editable_expression_cell.cpp \
   editable_expression_model_cell.cpp \
@@ -36,6 +37,7 @@ $(call create_module,escher,1,$(addprefix src/, \
   highlight_cell.cpp \
   highlight_image_cell.cpp \
   horizontal_or_vertical_layout.cpp \
+  idle_job.cpp \
   image_view.cpp \
   init.cpp \
   editable_field.cpp \
@@ -105,6 +107,7 @@ $(call create_module,escher,1,$(addprefix src/, \
 ) \
   image/caret.png \
   test/layout_field.cpp:+test \
+  test/view.cpp:+test \
 )
 
 ESCHER_VIEW_LOGGING ?= 0
@@ -113,6 +116,12 @@ ifneq ($(ESCHER_VIEW_LOGGING),0)
 SFLAGS_escher += -DESCHER_VIEW_LOGGING=1
 endif
 
+ESCHER_LOG_IDLE_JOBS ?= 0
+
+ifneq ($(ESCHER_LOG_IDLE_JOBS),0)
+SFLAGS_escher += -DESCHER_LOG_IDLE_JOBS=1
+endif
+
 $(call assert_defined,KANDINSKY_fonts_dependencies)
 $(call all_objects_for,$(SOURCES_escher)): $(KANDINSKY_fonts_dependencies)
 
@@ -60,6 +60,12 @@ Timer* Container::timerAtIndex(int i) {
   return containerTimerAtIndex(i - s_activeApp->numberOfTimers());
 }
 
+int Container::numberOfIdleJobs() { return s_activeApp->numberOfIdleJobs(); }
+
+IdleJob* Container::idleJobAtIndex(int i) {
+  return s_activeApp->idleJobAtIndex(i);
+}
+
 int Container::numberOfContainerTimers() { return 0; }
 
 Timer* Container::containerTimerAtIndex(int i) {
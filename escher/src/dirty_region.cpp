@@ -0,0 +1,80 @@
+#include <assert.h>
+#include <escher/dirty_region.h>
+
+namespace Escher {
+
+static int32_t Area(KDRect rect) {
+  return static_cast<int32_t>(rect.width()) * rect.height();
+}
+
+int32_t DirtyRegion::WastedArea(KDRect a, KDRect b) {
+  return Area(a.unionedWith(b)) - Area(a) - Area(b) +
+         Area(a.intersectedWith(b));
+}
+
+KDRect DirtyRegion::rectAtIndex(int index) const {
+  assert(0 <= index && index < m_numberOfRects);
+  return m_rects[index];
+}
+
+void DirtyRegion::removeRectAtIndex(int index) {
+  assert(0 <= index && index < m_numberOfRects);
+  m_numberOfRects--;
+  m_rects[index] = m_rects[m_numberOfRects];
+}
+
+void DirtyRegion::add(KDRect rect) {
+  if (rect.isEmpty()) {
+    return;
+  }
+  /* Absorb the rectangles that intersect rect or can be merged with it for
+   * free, and start over since the grown rect may now cover rectangles already
+   * checked. */
+  int index = 0;
+  while (index < m_numberOfRects) {
+    if (m_rects[index].containsRect(rect)) {
+      return;
+    }
+    if (m_rects[index].intersects(rect) ||
+        WastedArea(m_rects[index], rect) <= 0) {
+      rect = rect.unionedWith(m_rects[index]);
+      removeRectAtIndex(index);
+      index = 0;
+      continue;
+    }
+    index++;
+  }
+  if (m_numberOfRects < k_maxNumberOfRects) {
+    m_rects[m_numberOfRects++] = rect;
+    return;
+  }
+  /* The region is full: merge the cheapest pair among the stored rectangles
+   * and rect, the index k_maxNumberOfRects standing for rect. */
+  int bestI = 0;
+  int bestJ = k_maxNumberOfRects;
+  int32_t bestWaste = INT32_MAX;
+  for (int i = 0; i < k_maxNumberOfRects; i++) {
+    for (int j = i + 1; j <= k_maxNumberOfRects; j++) {
+      int32_t waste = WastedArea(
+          m_rects[i], j == k_maxNumberOfRects ? rect : m_rects[j]);
+      if (waste < bestWaste) {
+        bestWaste = waste;
+        bestI = i;
+        bestJ = j;
+      }
+    }
+  }
+  KDRect merged = m_rects[bestI];
+  if (bestJ == k_maxNumberOfRects) {
+    merged = merged.unionedWith(rect);
+  } else {
+    merged = merged.unionedWith(m_rects[bestJ]);
+    // Remove the highest index first so that bestI is not moved
+    removeRectAtIndex(bestJ);
+    m_rects[m_numberOfRects++] = rect;
+  }
+  removeRectAtIndex(bestI);
+  add(merged);
+}
+
+}  // namespace Escher
@@ -0,0 +1,47 @@
+#include <escher/idle_job.h>
+#include <ion/timing.h>
+#if ESCHER_LOG_IDLE_JOBS
+#include <ion/console.h>
+#include <omg/print.h>
+#endif
+
+namespace Escher {
+
+bool IdleJob::run() {
+  uint64_t start = Ion::Timing::millis();
+  bool completed = work();
+  m_workDuration += Ion::Timing::millis() - start;
+  m_numberOfSlices++;
+  return completed;
+}
+
+#if ESCHER_LOG_IDLE_JOBS
+static void logValue(const char* label, uint32_t value) {
+  constexpr int k_bufferSize = 11;
+  char buffer[k_bufferSize];
+  buffer[OMG::Print::IntLeft(value, buffer, k_bufferSize - 1)] = 0;
+  Ion::Console::writeLine(label, false);
+  Ion::Console::writeLine(buffer, false);
+}
+#endif
+
+bool IdleJob::updatePendingStatus(uint64_t time) {
+  bool pending = hasPendingWork();
+  if (pending && m_pendingSince == k_notPending) {
+    m_pendingSince = time;
+    m_workDuration = 0;
+    m_numberOfSlices = 0;
+  } else if (!pending && m_pendingSince != k_notPending) {
+    m_lastLatency = time - m_pendingSince;
+    m_pendingSince = k_notPending;
+#if ESCHER_LOG_IDLE_JOBS
+    logValue("Idle job done after ", m_lastLatency);
+    logValue(" ms, with ", m_workDuration);
+    logValue(" ms of idle work in ", m_numberOfSlices);
+    Ion::Console::writeLine(" slices");
+#endif
+  }
+  return pending;
+}
+
+}  // namespace Escher
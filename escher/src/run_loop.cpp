@@ -1,5 +1,7 @@
 #include <assert.h>
 #include <escher/run_loop.h>
+#include <ion/keyboard.h>
+#include <ion/timing.h>
 #include <kandinsky/font.h>
 #if ION_LOG_EVENTS_NAME
 #include <ion/console.h>
@@ -8,7 +10,7 @@
 
 namespace Escher {
 
-RunLoop::RunLoop() : m_time(0), m_breakAllLoops(false) {}
+RunLoop::RunLoop() : m_time(0), m_idle(false), m_breakAllLoops(false) {}
 
 int RunLoop::numberOfTimers() { return 0; }
 
@@ -17,6 +19,13 @@ Timer* RunLoop::timerAtIndex(int i) {
   return nullptr;
 }
 
+int RunLoop::numberOfIdleJobs() { return 0; }
+
+IdleJob* RunLoop::idleJobAtIndex(int i) {
+  assert(false);
+  return nullptr;
+}
+
 void RunLoop::run() { runWhile(nullptr, nullptr); }
 
 void RunLoop::runWhile(bool (*callback)(void* ctx), void* ctx) {
@@ -34,6 +43,15 @@ bool RunLoop::step() {
   // The device might want to listen to the USB before receiving an event.
   listenToExternalEvents();
 
+  /* While the user is inactive, pending idle jobs run instead of waiting for
+   * an event. External events such as USB plugs are thus delayed until the
+   * jobs are done or a key is pressed. */
+  IdleJob* job = pendingIdleJob();
+  if (m_idle && job) {
+    runIdleJob(job);
+    return true;
+  }
+
   // Fetch the event, if any
   int eventDuration = Timer::TickDuration;
   int timeout = eventDuration;
@@ -50,17 +68,9 @@ bool RunLoop::step() {
    * TickDuration.  The event returned can be None if nothing worth taking care
    * of happened. In other words, getEvent is a blocking call with a timeout. */
 
-  m_time += eventDuration;
+  didSpendTime(eventDuration);
+  m_idle = event == Ion::Events::None || event == Ion::Events::Idle;
 
-  if (m_time >= Timer::TickDuration) {
-    m_time -= Timer::TickDuration;
-    for (int i = 0; i < numberOfTimers(); i++) {
-      Timer* timer = timerAtIndex(i);
-      if (timer->tick()) {
-        dispatchEvent(Ion::Events::TimerFire);
-      }
-    }
-  }
   if (event != Ion::Events::None) {
 #if ESCHER_LOG_EVENTS_BINARY
     Ion::Console::writeChar(static_cast<uint8_t>(event));
@@ -94,4 +104,52 @@ bool RunLoop::step() {
   return event != Ion::Events::Termination;
 }
 
+void RunLoop::didSpendTime(int duration) {
+  m_time += duration;
+  /* Idle jobs may have run for more than one tick, but timers are only ticked
+   * once: they are not late enough to fire several times in a row. */
+  if (m_time >= Timer::TickDuration) {
+    m_time %= Timer::TickDuration;
+    for (int i = 0; i < numberOfTimers(); i++) {
+      Timer* timer = timerAtIndex(i);
+      if (timer->tick()) {
+        dispatchEvent(Ion::Events::TimerFire);
+      }
+    }
+  }
+}
+
+IdleJob* RunLoop::pendingIdleJob() {
+  int n = numberOfIdleJobs();
+  if (n == 0) {
+    return nullptr;
+  }
+  uint64_t time = Ion::Timing::millis();
+  IdleJob* result = nullptr;
+  for (int i = 0; i < n; i++) {
+    IdleJob* job = idleJobAtIndex(i);
+    // Every job is asked, to keep its statistics up to date
+    if (job->updatePendingStatus(time) &&
+        (!result || job->priority() > result->priority())) {
+      result = job;
+    }
+  }
+  return result;
+}
+
+void RunLoop::runIdleJob(IdleJob* job) {
+  uint64_t start = Ion::Timing::millis();
+  uint64_t elapsed = 0;
+  do {
+    if (!job->run() || Ion::Keyboard::scan() != Ion::Keyboard::State(0)) {
+      // Handle the key press before resuming the job
+      m_idle = false;
+    }
+    elapsed = Ion::Timing::millis() - start;
+  } while (m_idle && elapsed < k_idleStepDuration && job->hasPendingWork());
+  didSpendTime(elapsed);
+  // Draw what the job changed, as timers do
+  dispatchEvent(Ion::Events::TimerFire);
+}
+
 }  // namespace Escher
@@ -180,9 +180,45 @@ void ScrollView::layoutSubviews(bool force) {
 }
 
 void ScrollView::setContentOffset(KDPoint offset) {
-  if (m_dataSource->setOffset(offset)) {
-    layoutSubviews();
+  if (offset == contentOffset()) {
+    return;
+  }
+  /* The pixels of the content already on display are moved instead of being
+   * redrawn. */
+  KDRect previousInnerFrame = m_innerView.absoluteFrame();
+  KDPoint previousContentOrigin = m_contentView->absoluteOrigin();
+  DirtyRegion staleRegion;
+  willScrollPixels(m_contentView, &staleRegion);
+  m_dataSource->setOffset(offset);
+  layoutSubviews();
+  KDRect movedRect = m_innerView.absoluteFrame() == previousInnerFrame
+                         ? scrollablePixelsRect().intersectedWith(
+                               m_contentView->absoluteFrame())
+                         : KDRectZero;
+  didScrollPixels(
+      m_contentView, movedRect,
+      m_contentView->absoluteOrigin().relativeTo(previousContentOrigin),
+      staleRegion);
+}
+
+KDRect ScrollView::scrollablePixelsRect() {
+  /* The indicators are drawn over the inner view but do not scroll. Cut them
+   * out twice, since an indicator only spans the whole inner view once the
+   * other one is cut out. */
+  KDRect rect = m_innerView.absoluteFrame();
+  int numberOfIndicators = decorator()->numberOfIndicators();
+  for (int pass = 0; pass < 2; pass++) {
+    for (int i = 1; i <= numberOfIndicators; i++) {
+      rect = rect.differencedWith(
+          decorator()->indicatorAtIndex(i)->absoluteFrame());
+    }
+  }
+  for (int i = 1; i <= numberOfIndicators; i++) {
+    if (rect.intersects(decorator()->indicatorAtIndex(i)->absoluteFrame())) {
+      return KDRectZero;
+    }
   }
+  return rect;
 }
 
 KDRect ScrollView::layoutDecorator(bool force) {
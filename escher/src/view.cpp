@@ -7,6 +7,10 @@ extern "C" {
 
 namespace Escher {
 
+View::PendingScroll View::s_pendingScroll = {nullptr, KDRectZero, KDPointZero,
+                                             DirtyRegion()};
+View* View::s_movedView = nullptr;
+
 void View::markRectAsDirty(KDRect rect) {
   assert(!SumOverflowsKDCoordinate(rect.origin().x(), m_frame.origin().x()));
   assert(!SumOverflowsKDCoordinate(rect.origin().y(), m_frame.origin().y()));
@@ -19,39 +23,50 @@ void View::markAbsoluteRectAsDirty(KDRect rect) {
       rect.intersectedWith(m_frame));
 }
 
-KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
+void View::redraw(KDRect rect, DirtyRegion* redrawnRegion) {
   /* View::redraw recursively redraws the rectangle 'rect' of the view and all
    * its subviews.
-   * To optimize the function, we redraw only the union of the current dirty
-   * rectangle with a rectangle forced to be redrawn (forceRedrawRect). This
-   * rectangle is initially empty and recursively expands by unioning with the
-   * rectangles that are redrawn. This process handles the case when several
-   * sister views are overlapping (provided that the sister views are indexed in
-   * the right order).
-   */
-
-  /* First, for the current view, the rectangle to redraw is the union of the
-   * dirty rectangle and the rectangle forced to be redrawn. The rectangle to
-   * redraw must also be included in the current view bounds and in the
+   * To optimize the function, we redraw only the current dirty rectangle and
+   * the region that has already been redrawn (redrawnRegion). This region is
+   * initially empty and recursively expands with the rectangles that are
+   * redrawn. This process handles the case when several sister views are
+   * overlapping (provided that the sister views are indexed in the right
+   * order). The region keeps a few separate rectangles so that redrawing two
+   * distant views does not force redrawing everything in between. */
+
+  /* First, for the current view, the rectangles to redraw are the dirty
+   * rectangle and the parts of the redrawn region in the view. They must also
+   * be included in the current view bounds, and the dirty rectangle in the
    * rectangle rect. */
   if (rect.isEmpty()) {
-    return KDRectZero;
+    return;
   }
   KDRect visibleRect = rect.intersectedWith(m_frame);
-  KDRect rectNeedingRedraw =
-      visibleRect.intersectedWith(m_dirtyRect)
-          .unionedWith(forceRedrawRect.intersectedWith(m_frame));
+  if (s_pendingScroll.view == this) {
+    performPendingScroll(visibleRect, redrawnRegion);
+  }
+  KDRect dirtyRect = visibleRect.intersectedWith(m_dirtyRect);
+  DirtyRegion regionNeedingRedraw;
+  for (int i = 0; i < redrawnRegion->numberOfRects(); i++) {
+    regionNeedingRedraw.add(
+        redrawnRegion->rectAtIndex(i).intersectedWith(m_frame));
+  }
+  regionNeedingRedraw.add(dirtyRect);
 
-  // This redraws the rectNeedingRedraw calling drawRect.
-  if (!rectNeedingRedraw.isEmpty()) {
+  // This redraws each rectangle of regionNeedingRedraw calling drawRect.
+  if (!regionNeedingRedraw.isEmpty()) {
     KDPoint absOrigin = absoluteOrigin();
     KDContext* ctx = Ion::Display::Context::SharedContext;
     ctx->setOrigin(absOrigin);
-    ctx->setClippingRect(rectNeedingRedraw);
-    drawRect(ctx, rectNeedingRedraw.relativeTo(m_frame.origin()));
+    for (int i = 0; i < regionNeedingRedraw.numberOfRects(); i++) {
+      KDRect rectNeedingRedraw = regionNeedingRedraw.rectAtIndex(i);
+      ctx->setClippingRect(rectNeedingRedraw);
+      drawRect(ctx, rectNeedingRedraw.relativeTo(absOrigin));
+      /* This expands the area that has been redrawn. Merged rectangles may
+       * exceed the region, and what lies over them must be redrawn too. */
+      redrawnRegion->add(rectNeedingRedraw);
+    }
   }
-  // This initializes the area that has been redrawn.
-  KDRect redrawnArea = rectNeedingRedraw;
 
   // Then, let's recursively draw our children over ourself
   uint8_t subviewsNumber = numberOfSubviews();
@@ -62,18 +77,162 @@ KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
       continue;
     }
 
-    /* We redraw the current subview by passing the rectangle previously redrawn
-     * (by the parent view or previous sister views) as forced to be redraw. */
-    KDRect subviewRedrawnArea = subview->redraw(visibleRect, redrawnArea);
-
-    // We expand the redrawn area to include the area just drawn.
-    redrawnArea = redrawnArea.unionedWith(subviewRedrawnArea);
+    /* We redraw the current subview, which also has to redraw the region
+     * previously redrawn (by the parent view or previous sister views), and
+     * expands it with the area it draws. */
+    subview->redraw(visibleRect, redrawnRegion);
   }
   // Eventually, mark that we don't need to be redrawn
   m_dirtyRect = KDRectZero;
+}
 
-  // The function returns the total area that has been redrawn.
-  return redrawnArea;
+void View::addDirtyRectsToRegion(DirtyRegion* region,
+                                 const View* excludedView) {
+  region->add(m_dirtyRect.intersectedWith(m_frame));
+  uint8_t subviewsNumber = numberOfSubviews();
+  for (uint8_t i = 0; i < subviewsNumber; i++) {
+    View* subview = subviewAtIndex(i);
+    if (subview != nullptr && subview != excludedView) {
+      subview->addDirtyRectsToRegion(region, excludedView);
+    }
+  }
+}
+
+void View::willScrollPixels(View* movedView, DirtyRegion* staleRegion) {
+  /* The subviews of movedView may not be laid out yet, they must not be
+   * enumerated. Their dirty rectangles are moved by translate. */
+  addDirtyRectsToRegion(staleRegion, movedView);
+  if (s_movedView == nullptr) {
+    s_movedView = movedView;
+  }
+}
+
+void View::didScrollPixels(View* movedView, KDRect rect, KDPoint delta,
+                           const DirtyRegion& staleRegion) {
+  PendingScroll* scroll = &s_pendingScroll;
+  if (scroll->view == this && scroll->rect != rect) {
+    CancelPendingScroll();
+  }
+  if (s_movedView != movedView || rect.isEmpty() ||
+      (scroll->view != nullptr && scroll->view != this)) {
+    /* Only one scroll is moved at a time, the others are redrawn. A nested
+     * scroll did not prevent movedView from being dirtied. */
+    if (s_movedView == movedView) {
+      s_movedView = nullptr;
+    }
+    markAbsoluteRectAsDirty(movedView->m_frame);
+    return;
+  }
+  s_movedView = nullptr;
+  // The pixels of movedView that are not moved are redrawn
+  markAbsoluteRectAsDirty(
+      movedView->m_frame.intersectedWith(m_frame).differencedWith(rect));
+  addPendingScroll(rect, delta, staleRegion);
+}
+
+void View::scrollOwnPixels(KDRect rect, KDPoint delta,
+                           DirtyRegion staleRegion) {
+  rect = rect.translatedBy(m_frame.origin()).intersectedWith(m_frame);
+  PendingScroll* scroll = &s_pendingScroll;
+  if (scroll->view == this && scroll->rect != rect) {
+    CancelPendingScroll();
+  }
+  if (s_movedView != nullptr || rect.isEmpty() ||
+      (scroll->view != nullptr && scroll->view != this)) {
+    markAbsoluteRectAsDirty(rect);
+    return;
+  }
+  addDirtyRectsToRegion(&staleRegion, nullptr);
+  addPendingScroll(rect, delta, staleRegion);
+}
+
+void View::addPendingScroll(KDRect rect, KDPoint delta,
+                            const DirtyRegion& staleRegion) {
+  PendingScroll* scroll = &s_pendingScroll;
+  if (delta == KDPointZero) {
+    return;
+  }
+  if (scroll->view == this) {
+    /* The view scrolled again before being redrawn: the stale rectangles are
+     * moved back to where they were before the first scroll. */
+    for (int i = 0; i < staleRegion.numberOfRects(); i++) {
+      scroll->staleRegion.add(
+          staleRegion.rectAtIndex(i).translatedBy(scroll->delta.opposite()));
+    }
+    scroll->delta = scroll->delta.translatedBy(delta);
+  } else {
+    *scroll = {this, rect, delta, staleRegion};
+  }
+}
+
+void View::CancelPendingScroll() {
+  View* view = s_pendingScroll.view;
+  if (view != nullptr) {
+    s_pendingScroll.view = nullptr;
+    view->markAbsoluteRectAsDirty(s_pendingScroll.rect);
+  }
+}
+
+void View::ValidatePendingScroll(View* root) {
+  if (s_pendingScroll.view == nullptr) {
+    return;
+  }
+  bool foundScrollView = false;
+  if (!root->allowsPendingScroll(&foundScrollView)) {
+    CancelPendingScroll();
+  } else if (!foundScrollView) {
+    /* The view may have been destroyed. It will be redrawn anyway when it is
+     * attached again. */
+    s_pendingScroll.view = nullptr;
+  }
+}
+
+bool View::allowsPendingScroll(bool* foundScrollView) {
+  if (this == s_pendingScroll.view) {
+    // The subviews of the scrolled view are handled by the scroll
+    *foundScrollView = true;
+    return true;
+  }
+  if (*foundScrollView && m_frame.intersects(s_pendingScroll.rect)) {
+    // The view is drawn over the scrolled pixels
+    return false;
+  }
+  uint8_t subviewsNumber = numberOfSubviews();
+  for (uint8_t i = 0; i < subviewsNumber; i++) {
+    View* subview = subviewAtIndex(i);
+    if (subview != nullptr && !subview->allowsPendingScroll(foundScrollView)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void View::performPendingScroll(KDRect visibleRect,
+                                DirtyRegion* redrawnRegion) {
+  PendingScroll* scroll = &s_pendingScroll;
+  scroll->view = nullptr;
+  KDRect rect = scroll->rect.intersectedWith(visibleRect);
+  KDRect destination = rect.intersectedWith(rect.translatedBy(scroll->delta));
+  if (destination.isEmpty() ||
+      !Ion::Display::copyRect(
+          destination.translatedBy(scroll->delta.opposite()),
+          destination.origin())) {
+    redrawnRegion->add(rect);
+    return;
+  }
+  /* The pixels that were not up to date or that are redrawn before the view
+   * were moved too, so they are redrawn where they landed. */
+  DirtyRegion staleRegion = scroll->staleRegion;
+  for (int i = 0; i < redrawnRegion->numberOfRects(); i++) {
+    staleRegion.add(redrawnRegion->rectAtIndex(i).intersectedWith(rect));
+  }
+  for (int i = 0; i < staleRegion.numberOfRects(); i++) {
+    redrawnRegion->add(staleRegion.rectAtIndex(i)
+                           .translatedBy(scroll->delta)
+                           .intersectedWith(rect));
+  }
+  // The newly exposed pixels are redrawn
+  redrawnRegion->add(rect.differencedWith(destination));
 }
 
 void View::setSize(KDSize size) {
@@ -100,6 +259,10 @@ void View::setChildFrame(View* child, KDRect frame, bool force) {
 }
 
 void View::setFrame(KDRect frame, bool force) {
+  if (s_pendingScroll.view == this && (force || frame != m_frame)) {
+    // The pixels to move are no longer where the scroll expects them
+    CancelPendingScroll();
+  }
   if (!force) {
     if (frame == m_frame) {
       return;
@@ -115,7 +278,9 @@ void View::setFrame(KDRect frame, bool force) {
      * while not having been properly re-layouted earlier. */
     if (frame.size() == m_frame.size() && !m_frame.isEmpty()) {
       translate(frame.origin().relativeTo(m_frame.origin()));
-      markWholeFrameAsDirty();
+      if (this != s_movedView) {
+        markWholeFrameAsDirty();
+      }
       return;
     }
   }
@@ -136,9 +301,14 @@ void View::setFrame(KDRect frame, bool force) {
 }
 
 void View::translate(KDPoint delta) {
+  if (s_pendingScroll.view == this) {
+    CancelPendingScroll();
+  }
   assert(!SumOverflowsKDCoordinate(m_frame.origin().x(), delta.x()));
   assert(!SumOverflowsKDCoordinate(m_frame.origin().y(), delta.y()));
   m_frame = m_frame.translatedBy(delta);
+  // The pixels not up to date move with the view
+  m_dirtyRect = m_dirtyRect.translatedBy(delta);
   uint8_t subviewsNumber = numberOfSubviews();
   for (uint8_t i = 0; i < subviewsNumber; i++) {
     assert(subviewsNumber == numberOfSubviews());
@@ -9,9 +9,15 @@ namespace Escher {
 void Window::redraw(bool force) {
   if (force) {
     markWholeFrameAsDirty();
+    // Everything is redrawn, there is no need to move pixels
+    s_pendingScroll.view = nullptr;
   }
+  ValidatePendingScroll(this);
   Ion::Display::waitForVBlank();
-  View::redraw(bounds());
+  DirtyRegion redrawnRegion;
+  View::redraw(bounds(), &redrawnRegion);
+  // The scrolled view was not redrawn, it will be redrawn entirely
+  CancelPendingScroll();
 }
 
 void Window::setContentView(View* contentView) {
@@ -0,0 +1,192 @@
+#include <escher/dirty_region.h>
+#include <escher/scroll_view.h>
+#include <escher/view.h>
+#include <escher/window.h>
+#include <quiz.h>
+
+using namespace Escher;
+
+static int32_t area(KDRect rect) {
+  return static_cast<int32_t>(rect.width()) * rect.height();
+}
+
+static bool region_covers(const DirtyRegion& region, KDRect rect) {
+  for (int i = 0; i < region.numberOfRects(); i++) {
+    rect = rect.differencedWith(region.rectAtIndex(i));
+  }
+  return rect.isEmpty();
+}
+
+QUIZ_CASE(escher_dirty_region) {
+  DirtyRegion region;
+  region.add(KDRectZero);
+  quiz_assert(region.isEmpty());
+
+  // Distant rectangles are kept apart
+  KDRect topLeft(0, 0, 10, 10);
+  KDRect bottomRight(300, 200, 10, 10);
+  region.add(topLeft);
+  region.add(bottomRight);
+  quiz_assert(region.numberOfRects() == 2);
+
+  // Covered rectangles are ignored, and adjacent ones merged for free
+  region.add(KDRect(2, 2, 5, 5));
+  region.add(KDRect(10, 0, 10, 10));
+  quiz_assert(region.numberOfRects() == 2);
+  quiz_assert(region_covers(region, KDRect(0, 0, 20, 10)));
+
+  // Intersecting rectangles are merged
+  region.add(KDRect(305, 205, 10, 10));
+  quiz_assert(region.numberOfRects() == 2);
+
+  // A full region merges the closest rectangles and still covers everything
+  KDRect added[] = {KDRect(0, 100, 5, 5), KDRect(200, 0, 5, 5),
+                    KDRect(100, 200, 5, 5), KDRect(0, 200, 5, 5)};
+  for (KDRect rect : added) {
+    region.add(rect);
+  }
+  quiz_assert(region.numberOfRects() == DirtyRegion::k_maxNumberOfRects);
+  for (KDRect rect : added) {
+    quiz_assert(region_covers(region, rect));
+  }
+  quiz_assert(region_covers(region, KDRect(0, 0, 20, 10)));
+  quiz_assert(region_covers(region, KDRect(300, 200, 15, 15)));
+  for (int i = 0; i < region.numberOfRects(); i++) {
+    for (int j = i + 1; j < region.numberOfRects(); j++) {
+      quiz_assert(!region.rectAtIndex(i).intersects(region.rectAtIndex(j)));
+    }
+  }
+}
+
+class DrawCountingView : public View {
+ public:
+  void drawRect(KDContext* ctx, KDRect rect) const override {
+    m_drawnArea += area(rect);
+  }
+  void markRectAsDirty(KDRect rect) { View::markRectAsDirty(rect); }
+  int32_t drawnArea() const { return m_drawnArea; }
+  void reset() { m_drawnArea = 0; }
+
+ private:
+  mutable int32_t m_drawnArea = 0;
+};
+
+class ThreeViews : public View {
+ public:
+  constexpr static KDRect k_firstFrame = KDRect(0, 0, 20, 20);
+  constexpr static KDRect k_secondFrame = KDRect(200, 200, 20, 20);
+  constexpr static KDRect k_thirdFrame = KDRect(40, 40, 140, 140);
+
+  DrawCountingView* viewAtIndex(int index) { return &m_views[index]; }
+
+ private:
+  int numberOfSubviews() const override { return 3; }
+  View* subviewAtIndex(int index) override { return &m_views[index]; }
+  void layoutSubviews(bool force) override {
+    setChildFrame(&m_views[0], k_firstFrame, force);
+    setChildFrame(&m_views[1], k_secondFrame, force);
+    setChildFrame(&m_views[2], k_thirdFrame, force);
+  }
+
+  DrawCountingView m_views[3];
+};
+
+QUIZ_CASE(escher_view_redraw_distant_rects) {
+  Window window;
+  window.setAbsoluteFrame(KDRect(0, 0, 240, 240));
+  ThreeViews content;
+  window.setContentView(&content);
+  window.redraw(true);
+
+  for (int i = 0; i < 3; i++) {
+    content.viewAtIndex(i)->reset();
+  }
+  content.viewAtIndex(0)->markRectAsDirty(KDRect(0, 0, 5, 5));
+  content.viewAtIndex(1)->markRectAsDirty(KDRect(10, 10, 5, 5));
+  window.redraw();
+  /* The third view lies between the first two but does not overlap them, so
+   * their redrawn areas must not force it to be redrawn. */
+  quiz_assert(content.viewAtIndex(0)->drawnArea() == 25);
+  quiz_assert(content.viewAtIndex(1)->drawnArea() == 25);
+  quiz_assert(content.viewAtIndex(2)->drawnArea() == 0);
+}
+
+class TallView : public DrawCountingView {
+ public:
+  KDSize minimalSizeForOptimalDisplay() const override {
+    return KDSize(100, 1000);
+  }
+};
+
+class TestScrollView : public ScrollView {
+ public:
+  TestScrollView(View* contentView) : ScrollView(contentView, &m_dataSource) {}
+  Decorator* decorator() override { return &m_decorator; }
+
+ private:
+  ScrollViewDataSource m_dataSource;
+  NoDecorator m_decorator;
+};
+
+class ScrollAndOverlay : public View {
+ public:
+  ScrollAndOverlay() : m_scrollView(&m_content) {}
+  TestScrollView* scrollView() { return &m_scrollView; }
+  TallView* content() { return &m_content; }
+  void showOverlay(bool show) {
+    m_showOverlay = show;
+    markWholeFrameAsDirty();
+  }
+
+ private:
+  int numberOfSubviews() const override { return 1 + m_showOverlay; }
+  View* subviewAtIndex(int index) override {
+    return index == 0 ? static_cast<View*>(&m_scrollView) : &m_overlay;
+  }
+  void layoutSubviews(bool force) override {
+    setChildFrame(&m_scrollView, KDRect(0, 0, 100, 100), force);
+    setChildFrame(&m_overlay, KDRect(40, 40, 20, 20), force);
+  }
+
+  TallView m_content;
+  TestScrollView m_scrollView;
+  DrawCountingView m_overlay;
+  bool m_showOverlay = false;
+};
+
+QUIZ_CASE(escher_view_scroll_pixels) {
+  Window window;
+  window.setAbsoluteFrame(KDRect(0, 0, 100, 100));
+  ScrollAndOverlay view;
+  window.setContentView(&view);
+  window.redraw(true);
+  quiz_assert(view.content()->drawnArea() == 100 * 100);
+
+  // Only the newly exposed band is redrawn
+  view.content()->reset();
+  view.scrollView()->setContentOffset(KDPoint(0, 10));
+  window.redraw();
+  quiz_assert(view.content()->drawnArea() == 100 * 10);
+
+  // Successive scrolls are moved at once
+  view.content()->reset();
+  view.scrollView()->setContentOffset(KDPoint(0, 30));
+  view.scrollView()->setContentOffset(KDPoint(0, 25));
+  window.redraw();
+  quiz_assert(view.content()->drawnArea() == 100 * 15);
+
+  // Areas that were dirty before scrolling are redrawn where they moved to
+  view.content()->reset();
+  view.content()->markRectAsDirty(KDRect(0, 50, 100, 5));
+  view.scrollView()->setContentOffset(KDPoint(0, 35));
+  window.redraw();
+  quiz_assert(view.content()->drawnArea() == 100 * 10 + 100 * 5);
+
+  // Pixels under another view cannot be moved
+  view.showOverlay(true);
+  window.redraw();
+  view.content()->reset();
+  view.scrollView()->setContentOffset(KDPoint(0, 45));
+  window.redraw();
+  quiz_assert(view.content()->drawnArea() == 100 * 100);
+}
@@ -23,6 +23,9 @@ namespace Display {
 void pushRect(KDRect r, const KDColor* pixels);
 void pushRectUniform(KDRect r, KDColor c);
 void pullRect(KDRect r, KDColor* pixels);
+/* Move the pixels of the rect r, which may overlap the destination. Returns
+ * false if the display cannot copy pixels faster than they are redrawn. */
+bool copyRect(KDRect r, KDPoint destination);
 
 bool waitForVBlank();
 void refreshDisplay();
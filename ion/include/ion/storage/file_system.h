@@ -155,6 +155,10 @@ class FileSystem {
                              bool destroyRecordWithSameFullName,
                              bool notifyDelegate = true);
 
+  /* Forget where records are, to be called when the buffer may have been
+   * written from outside (DFU). */
+  void invalidateIndex();
+
  private:
   constexpr static uint32_t Magic = 0xEE0BDDBA;
   constexpr static size_t k_maxRecordSize = (1 << sizeof(record_size_t) * 8);
@@ -174,6 +178,42 @@ class FileSystem {
   Record recordWithFilterAtIndex(const char* extension, int index,
                                  RecordFilter filter,
                                  const void* auxiliary = nullptr);
+
+  /* Records with an extension are usually enumerated by increasing index
+   * (list controllers), so the last one found is remembered to resume the
+   * search from it instead of scanning the buffer from the start. The number
+   * of records matching the filter is remembered as well. The auxiliary of
+   * these filters is always a single char. */
+  class FilterCursor {
+   public:
+    constexpr static size_t k_maxExtensionSize = 8;
+    FilterCursor() { invalidate(); }
+    void invalidate() {
+      m_extension[0] = 0;
+      m_recordStart = nullptr;
+      m_numberOfRecords = -1;
+    }
+    bool isOnFilter(const char* extension, RecordFilter filter,
+                    const void* auxiliary) const;
+    void setFilter(const char* extension, RecordFilter filter,
+                   const void* auxiliary);
+    char* recordStart() const { return m_recordStart; }
+    int index() const { return m_index; }
+    void setRecord(char* recordStart, int index) {
+      m_recordStart = recordStart;
+      m_index = index;
+    }
+    int numberOfRecords() const { return m_numberOfRecords; }
+    void setNumberOfRecords(int n) { m_numberOfRecords = n; }
+
+   private:
+    char m_extension[k_maxExtensionSize];
+    RecordFilter m_filter;
+    char m_auxiliary;
+    char* m_recordStart;
+    int m_index;
+    int m_numberOfRecords;
+  };
   void destroyRecordsMatching(RecordFilter filter, const void* auxiliary);
 
   FileSystem();
@@ -201,6 +241,41 @@ class FileSystem {
   char* endBuffer();
   size_t sizeOfRecordWithName(Record::Name name, size_t dataSize);
   bool slideBuffer(char* position, int delta);
+
+  /* Open addressing index from the CRC32 of the records' full names to their
+   * offset in the buffer. It spares hashing the name of every record until the
+   * one looked for is found. It is updated along with the buffer, and rebuilt
+   * on the next lookup once invalidated. If there are too many records to be
+   * indexed, they are searched linearly. */
+  class Index {
+   public:
+    constexpr static int k_size = 256;
+    constexpr static int k_maxNumberOfRecords = k_size * 7 / 8;
+    constexpr static int k_noOffset = -1;
+
+    Index() : m_status(Status::Invalid) {}
+    bool isValid() const { return m_status == Status::Valid; }
+    bool isOverflowed() const { return m_status == Status::Overflowed; }
+    void invalidate() { m_status = Status::Invalid; }
+    void clear();
+    int offsetOfRecord(Record record) const;
+    void insert(Record record, size_t offset);
+    void remove(Record record);
+    // Shift the records located after offset
+    void shift(size_t offset, int delta);
+
+   private:
+    enum class Status : uint8_t { Valid, Invalid, Overflowed };
+    // The null Record has a CRC32 of 0 and marks empty slots
+    int slotOfRecord(Record record) const;
+
+    uint32_t m_crc32s[k_size];
+    record_size_t m_offsets[k_size];
+    int m_numberOfRecords;
+    Status m_status;
+  };
+  // Return false if the records cannot be indexed
+  bool updateIndex() const;
   class RecordIterator {
    public:
     RecordIterator(char* start) : m_recordStart(start) {}
@@ -237,6 +312,8 @@ class FileSystem {
   size_t m_accessibleSize;
   mutable Record m_lastRecordRetrieved;
   mutable char* m_lastRecordRetrievedPointer;
+  mutable Index m_index;
+  FilterCursor m_cursor;
 };
 
 }  // namespace Storage
@@ -109,6 +109,14 @@ SOURCES_ion += $(_ion_simulator_window_setup)
 
 # Simulator files - end
 
+# Events benchmark: replay scenarios and print their timings as JSON
+
+ION_EVENTS_BENCHMARK ?= 0
+ifneq ($(ION_EVENTS_BENCHMARK),0)
+SOURCES_ion += $(PATH_ion)/src/simulator/shared/events_benchmark.cpp
+PRIVATE_SFLAGS_ion += -DION_EVENTS_BENCHMARK=1
+endif
+
 # ION_external_apps is for the caller of ion to choose if it wants apps
 # _ion_external_apps is for particular platforms to tell if they support it
 ION_external_apps ?= 1
@@ -19,6 +19,11 @@ void SVC_ATTRIBUTES pullRect(KDRect r, KDColor* pixels) {
   SVC_RETURNING_VOID(SVC_DISPLAY_PULL_RECT)
 }
 
+/* The panel has no command to copy pixels. They would have to be pulled back
+ * through the kernel and pushed again, which has not been measured to be
+ * faster than redrawing them. */
+bool copyRect(KDRect r, KDPoint destination) { return false; }
+
 bool SVC_ATTRIBUTES waitForVBlank() {
   SVC_RETURNING_R0(SVC_DISPLAY_WAIT_FOR_V_BLANK, bool)
 }
@@ -6,6 +6,7 @@ namespace Display {
 void pushRect(KDRect r, const KDColor* pixels) {}
 void pushRectUniform(KDRect r, KDColor c) {}
 void pullRect(KDRect r, KDColor* pixels) {}
+bool copyRect(KDRect r, KDPoint destination) { return false; }
 void setScreenshotCallback(void (*callback)()) {}
 
 }  // namespace Display
@@ -79,6 +79,8 @@ size_t FileSystem::putAvailableSpaceAtEndOfRecord(Record r) {
           (m_buffer + m_accessibleSize - availableStorageSize) - nextRecord);
   size_t newRecordSize = previousRecordSize + availableStorageSize;
   overrideSizeAtPosition(p, (record_size_t)newRecordSize);
+  m_index.shift(nextRecord - m_buffer, availableStorageSize);
+  m_cursor.invalidate();
   return newRecordSize;
 }
 
@@ -89,6 +91,8 @@ void FileSystem::removeDataFromEndOfRecord(Record r, size_t dataSize) {
   memmove(nextRecord - dataSize, nextRecord,
           m_buffer + m_accessibleSize - nextRecord);
   overrideSizeAtPosition(p, (record_size_t)(previousRecordSize - dataSize));
+  m_index.shift(nextRecord - m_buffer, -static_cast<int>(dataSize));
+  m_cursor.invalidate();
 }
 
 uint32_t FileSystem::checksum() {
@@ -221,6 +225,8 @@ Record::ErrorStatus FileSystem::createRecordWithDataChunks(
   // Next Record is null-sized
   overrideSizeAtPosition(newRecord, 0);
   Record r = Record(recordName);
+  m_index.insert(r, newRecordAddress - m_buffer);
+  m_cursor.invalidate();
   notifyChangeToDelegate(r);
   m_lastRecordRetrieved = r;
   m_lastRecordRetrievedPointer = newRecordAddress;
@@ -241,6 +247,10 @@ int FileSystem::numberOfRecords() {
 int FileSystem::numberOfRecordsWithFilter(const char* extension,
                                           RecordFilter filter,
                                           const void* auxiliary) {
+  if (m_cursor.isOnFilter(extension, filter, auxiliary) &&
+      m_cursor.numberOfRecords() >= 0) {
+    return m_cursor.numberOfRecords();
+  }
   int count = 0;
   for (char* p : *this) {
     Record::Name currentName = nameOfRecordStarting(p);
@@ -250,6 +260,10 @@ int FileSystem::numberOfRecordsWithFilter(const char* extension,
       count++;
     }
   }
+  if (!m_cursor.isOnFilter(extension, filter, auxiliary)) {
+    m_cursor.setFilter(extension, filter, auxiliary);
+  }
+  m_cursor.setNumberOfRecords(count);
   return count;
 }
 
@@ -259,7 +273,18 @@ Record FileSystem::recordWithFilterAtIndex(const char* extension, int index,
   int currentIndex = -1;
   Record::Name name = Record::EmptyName();
   char* recordAddress = nullptr;
-  for (char* p : *this) {
+  RecordIterator start = begin();
+  if (m_cursor.isOnFilter(extension, filter, auxiliary)) {
+    if (m_cursor.recordStart() && m_cursor.index() <= index) {
+      // Resume from the last record found, which is counted again
+      start = RecordIterator(m_cursor.recordStart());
+      currentIndex = m_cursor.index() - 1;
+    }
+  } else {
+    m_cursor.setFilter(extension, filter, auxiliary);
+  }
+  for (RecordIterator it = start; it != end(); ++it) {
+    char* p = *it;
     Record::Name currentName = nameOfRecordStarting(p);
     assert(currentName.extension);
     if (!Record::NameIsEmpty(currentName) && filter(currentName, auxiliary) &&
@@ -275,6 +300,7 @@ Record FileSystem::recordWithFilterAtIndex(const char* extension, int index,
   if (Record::NameIsEmpty(name)) {
     return Record();
   }
+  m_cursor.setRecord(recordAddress, index);
   Record r = Record(name);
   m_lastRecordRetrieved = r;
   m_lastRecordRetrievedPointer = recordAddress;
@@ -348,6 +374,8 @@ void FileSystem::disableAllRecords() {
   overrideSizeAtPosition(firstNonSysRecord, 0);
   // Disable the records by artificially reducing the size of the storage.
   m_accessibleSize -= valueSize;
+  m_index.invalidate();
+  m_cursor.invalidate();
   // Clear memoized records
   notifyChangeToDelegate();
 }
@@ -365,6 +393,8 @@ void FileSystem::restoreDisabledRecords() {
   overrideSizeAtPosition(previousEndBuffer + k_totalSize - m_accessibleSize, 0);
   // Restore storage size
   m_accessibleSize = k_totalSize;
+  m_index.invalidate();
+  m_cursor.invalidate();
 }
 
 bool FileSystem::handleCompetingRecord(Record::Name recordName,
@@ -404,6 +434,13 @@ bool FileSystem::handleCompetingRecord(Record::Name recordName,
   return true;
 }
 
+void FileSystem::invalidateIndex() {
+  m_index.invalidate();
+  m_cursor.invalidate();
+  m_lastRecordRetrieved = Record(nullptr);
+  m_lastRecordRetrievedPointer = nullptr;
+}
+
 // PRIVATE
 
 void FileSystem::destroyRecordsMatching(RecordFilter filter,
@@ -478,6 +515,8 @@ Record::ErrorStatus FileSystem::setNameOfRecord(Record* record,
     overrideSizeAtPosition(p, newRecordSize);
     char* namePosition = p + sizeof(record_size_t);
     overrideNameAtPosition(namePosition, name);
+    m_index.remove(oldRecord);
+    m_index.insert(newRecord, p - m_buffer);
     // Recompute the CRC32
     *record = newRecord;
     notifyChangeToDelegate(newRecord);
@@ -541,6 +580,7 @@ bool FileSystem::destroyRecord(Record record, bool notifyDelegate) {
   char* p = pointerOfRecord(record);
   if (p) {
     record_size_t previousRecordSize = sizeOfRecordStarting(p);
+    m_index.remove(record);
     slideBuffer(p + previousRecordSize, -previousRecordSize);
     if (notifyDelegate) {
       notifyChangeToDelegate();
@@ -557,6 +597,17 @@ char* FileSystem::pointerOfRecord(const Record record) const {
     assert(m_lastRecordRetrievedPointer);
     return m_lastRecordRetrievedPointer;
   }
+  if (updateIndex()) {
+    int offset = m_index.offsetOfRecord(record);
+    if (offset == Index::k_noOffset) {
+      return nullptr;
+    }
+    char* p = const_cast<char*>(m_buffer) + offset;
+    assert(Record(nameOfRecordStarting(p)) == record);
+    m_lastRecordRetrieved = record;
+    m_lastRecordRetrievedPointer = p;
+    return p;
+  }
   for (char* p : *this) {
     Record currentRecord(nameOfRecordStarting(p));
     if (record == currentRecord) {
@@ -618,6 +669,10 @@ bool FileSystem::isNameOfRecordTaken(Record r, const Record* recordToExclude) {
      * name is nullptr. */
     return true;
   }
+  if (updateIndex()) {
+    return !(recordToExclude && r == *recordToExclude) &&
+           m_index.offsetOfRecord(r) != Index::k_noOffset;
+  }
   for (char* p : *this) {
     Record s(nameOfRecordStarting(p));
     if (recordToExclude && s == *recordToExclude) {
@@ -653,9 +708,25 @@ bool FileSystem::slideBuffer(char* position, int delta) {
          m_buffer + m_accessibleSize);
   memmove(position + delta, position,
           endBuffer() + sizeof(record_size_t) - position);
+  m_index.shift(position - m_buffer, delta);
+  m_cursor.invalidate();
   return true;
 }
 
+bool FileSystem::updateIndex() const {
+  if (m_index.isValid()) {
+    return true;
+  }
+  if (m_index.isOverflowed()) {
+    return false;
+  }
+  m_index.clear();
+  for (char* p : *this) {
+    m_index.insert(Record(nameOfRecordStarting(p)), p - m_buffer);
+  }
+  return m_index.isValid();
+}
+
 Record FileSystem::privateRecordBasedNamedWithExtensions(
     const char* baseName, int baseNameLength, const char* const extensions[],
     size_t numberOfExtensions, const char** extensionResult) {
@@ -701,6 +772,108 @@ bool FileSystem::recordNameHasBaseNameAndOneOfTheseExtensions(
   return false;
 }
 
+void FileSystem::Index::clear() {
+  for (int i = 0; i < k_size; i++) {
+    m_crc32s[i] = 0;
+  }
+  m_numberOfRecords = 0;
+  m_status = Status::Valid;
+}
+
+int FileSystem::Index::slotOfRecord(Record record) const {
+  assert(isValid() && !record.isNull());
+  int slot = static_cast<uint32_t>(record) % k_size;
+  // The index is never full, an empty slot ends the probing
+  while (m_crc32s[slot] != 0 && Record(m_crc32s[slot]) != record) {
+    slot = (slot + 1) % k_size;
+  }
+  return slot;
+}
+
+int FileSystem::Index::offsetOfRecord(Record record) const {
+  int slot = slotOfRecord(record);
+  return m_crc32s[slot] == 0 ? k_noOffset : m_offsets[slot];
+}
+
+void FileSystem::Index::insert(Record record, size_t offset) {
+  if (!isValid()) {
+    return;
+  }
+  if (m_numberOfRecords == k_maxNumberOfRecords) {
+    m_status = Status::Overflowed;
+    return;
+  }
+  int slot = slotOfRecord(record);
+  assert(m_crc32s[slot] == 0);
+  m_crc32s[slot] = static_cast<uint32_t>(record);
+  m_offsets[slot] = offset;
+  m_numberOfRecords++;
+}
+
+void FileSystem::Index::remove(Record record) {
+  if (isOverflowed()) {
+    // There may now be few enough records to index them
+    invalidate();
+  }
+  if (!isValid()) {
+    return;
+  }
+  int slot = slotOfRecord(record);
+  if (m_crc32s[slot] == 0) {
+    return;
+  }
+  m_crc32s[slot] = 0;
+  m_numberOfRecords--;
+  /* Move back the following records of the cluster that would not be found
+   * anymore because of the emptied slot. */
+  int next = (slot + 1) % k_size;
+  while (m_crc32s[next] != 0) {
+    int ideal = m_crc32s[next] % k_size;
+    if ((next > slot && (ideal <= slot || ideal > next)) ||
+        (next < slot && ideal <= slot && ideal > next)) {
+      m_crc32s[slot] = m_crc32s[next];
+      m_offsets[slot] = m_offsets[next];
+      m_crc32s[next] = 0;
+      slot = next;
+    }
+    next = (next + 1) % k_size;
+  }
+}
+
+void FileSystem::Index::shift(size_t offset, int delta) {
+  if (!isValid()) {
+    return;
+  }
+  for (int i = 0; i < k_size; i++) {
+    if (m_crc32s[i] != 0 && m_offsets[i] >= offset) {
+      m_offsets[i] += delta;
+    }
+  }
+}
+
+bool FileSystem::FilterCursor::isOnFilter(const char* extension,
+                                          RecordFilter filter,
+                                          const void* auxiliary) const {
+  return m_extension[0] != 0 && m_filter == filter &&
+         m_auxiliary ==
+             (auxiliary ? *static_cast<const char*>(auxiliary) : 0) &&
+         strcmp(m_extension, extension) == 0;
+}
+
+void FileSystem::FilterCursor::setFilter(const char* extension,
+                                         RecordFilter filter,
+                                         const void* auxiliary) {
+  invalidate();
+  size_t extensionSize = strlen(extension) + 1;
+  if (extensionSize > k_maxExtensionSize) {
+    // Leave the cursor invalid
+    return;
+  }
+  memcpy(m_extension, extension, extensionSize);
+  m_filter = filter;
+  m_auxiliary = auxiliary ? *static_cast<const char*>(auxiliary) : 0;
+}
+
 FileSystem::RecordIterator& FileSystem::RecordIterator::operator++() {
   assert(m_recordStart);
   record_size_t size = OMG::unalignedShort(m_recordStart);
@@ -0,0 +1,349 @@
+#include "events_benchmark.h"
+
+#include <assert.h>
+#include <ion/events.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "events.h"
+#if ION_SIMULATOR_FILES
+#include "state_file.h"
+#endif
+
+namespace Ion {
+namespace Simulator {
+namespace EventsBenchmark {
+
+using namespace Ion::Events;
+
+constexpr static Event scenarioCalculation[] = {
+    OK, Pi, Plus, One, Division, Two, OK,   OK,   Sqrt, Zero, Dot,  Two,
+    OK, OK, Up,   Up,  Up,       Up,  Down, Down, Down, Down, Home, Home};
+
+constexpr static Event scenarioFunctionCosSin[] = {
+    Right, OK,   OK,   Cosine, XNT,  OK,   Down, OK,   Sine, XNT,  OK,
+    Down,  Down, OK,   Left,   Left, Left, Left, Left, Left, Left, Left,
+    Left,  Left, Left, Left,   Left, Left, Left, Left, Left, Left, Left,
+    Left,  Left, Left, Left,   Left, Left, Left, Left, Left, Left, Left,
+    Left,  Left, Left, Left,   Left, Left, Left, Left, Left, Left, Left,
+    Left,  Left, Left, Left,   Left, Left, Left, Left, Left, Home, Home};
+
+constexpr static Event scenarioPythonMandelbrot[] = {
+    Down, Down, Down, Right, OK,  Down, Down, Down, Down, Down,
+    OK,   Var,  Down, OK,    One, Five, OK,   Home, Home};
+
+constexpr static Event scenarioStatistics[] = {
+    Down, OK,   One,  OK,    Two,   OK,    Right, Five,  OK,   One,
+    Zero, OK,   Back, Right, OK,    Right, Right, Right, OK,   One,
+    OK,   Down, OK,   Back,  Right, OK,    Back,  Right, OK,   Down,
+    Down, Down, Down, Down,  Down,  Down,  Down,  Down,  Down, Up,
+    Up,   Up,   Up,   Up,    Up,    Up,    Up,    Up,    Home, Home};
+
+constexpr static Event scenarioProbability[] = {
+    Down,  Right, OK,    Down, Down, Down,  OK,   Two,  OK,
+    Zero,  Dot,   Three, OK,   OK,   Left,  Down, Down, OK,
+    Right, Right, Right, Zero, Dot,  Eight, OK,   Home, Home};
+
+constexpr static Event scenarioEquation[] = {
+    Down, Right, Right, OK,   OK,   Down, Down, OK,   Six,  OK,
+    Down, Down,  OK,    Left, Left, Left, Down, Down, Home, Home};
+
+// Only the scrolling steps through the calculation history are measured
+constexpr static int k_scrollingSetupLength = 25;
+constexpr static int k_scrollingTeardownLength = 2;
+constexpr static Event scenarioScrolling[] = {
+    // Setup: fill the history with 11 calculations
+    OK, One, OK, Two, OK, Three, OK, Four, OK, Five, OK, Six, OK, Seven, OK,
+    Eight, OK, Nine, OK, One, Zero, OK, One, One, OK,
+    // Scrolling steps
+    Up, Up, Up, Up, Up, Up, Up, Up, Up, Up, Up, Up, Down, Down, Down, Down,
+    Down, Down, Down, Down, Down, Down, Down, Down,
+    // Teardown
+    Home, Home};
+
+constexpr static int k_scriptScrollingSetupLength = 5;
+constexpr static int k_scriptScrollingTeardownLength = 2;
+constexpr static Event scenarioScriptScrolling[] = {
+    // Setup: open mandelbrot.py in the editor
+    Right, Right, OK, Down, OK,
+    // Scrolling steps
+    Down, Down, Down, Down, Down, Down, Down, Down, Down, Down, Down, Down,
+    Down, Down, Down, Down, Up, Up, Up, Up, Up, Up, Up, Up, Up, Up, Up, Up,
+    Up, Up, Up, Up,
+    // Teardown
+    Home, Home};
+
+using Clock = std::chrono::steady_clock;
+
+class Scenario {
+ public:
+  Scenario(const char* name) : m_name(name) {}
+  /* The first setupLength and the last teardownLength events are replayed but
+   * not measured. */
+  template <int N>
+  Scenario(const char* name, const Event (&events)[N], int setupLength = 0,
+           int teardownLength = 0)
+      : m_name(name),
+        m_events(events, events + N),
+        m_firstMeasuredEvent(setupLength),
+        m_lastMeasuredEvent(N - 1 - teardownLength) {}
+
+  const char* name() const { return m_name.c_str(); }
+  int numberOfEvents() const { return m_events.size(); }
+  Event eventAtIndex(int index) const { return m_events[index]; }
+  const char* textAtIndex(int index) const { return m_texts[index].c_str(); }
+  bool isMeasured(int index) const {
+    return index >= m_firstMeasuredEvent &&
+           (m_lastMeasuredEvent < 0 || index <= m_lastMeasuredEvent);
+  }
+  void pushEvent(Event e) {
+    m_events.push_back(e);
+    if (e == ExternalText) {
+      m_texts.push_back(sharedExternalTextBuffer());
+    }
+  }
+
+  void addEventLatency(Clock::duration d) { m_eventLatencies.push_back(d); }
+  void addFrameTime(Clock::duration d) { m_frameTimes.push_back(d); }
+  void addFramePixels(long long pixels) { m_framePixels.push_back(pixels); }
+  void report(FILE* f) const;
+
+ private:
+  static void ReportValues(FILE* f, const char* name, const char* unit,
+                           std::vector<long long> values);
+  static void ReportDurations(FILE* f, const char* name,
+                              const std::vector<Clock::duration>& durations);
+
+  std::string m_name;
+  std::vector<Event> m_events;
+  // Texts of the ExternalText events, in the order of the events
+  std::vector<std::string> m_texts;
+  int m_firstMeasuredEvent = 0;
+  // Negative if the events are measured until the end
+  int m_lastMeasuredEvent = -1;
+  std::vector<Clock::duration> m_eventLatencies;
+  std::vector<Clock::duration> m_frameTimes;
+  // Number of pixels pushed to the display in response to each event
+  std::vector<long long> m_framePixels;
+};
+
+void Scenario::ReportValues(FILE* f, const char* name, const char* unit,
+                           std::vector<long long> values) {
+  fprintf(f, "\"%s\":{", name);
+  if (!values.empty()) {
+    std::sort(values.begin(), values.end());
+    size_t n = values.size();
+    // Nearest-rank percentiles
+    long long min = values[0];
+    long long median = values[(n - 1) / 2];
+    long long p95 = values[(95 * n + 99) / 100 - 1];
+    fprintf(f, "\"min_%s\":%lld,\"median_%s\":%lld,\"p95_%s\":%lld,", unit,
+            min, unit, median, unit, p95);
+  }
+  fprintf(f, "\"samples\":%zu}", values.size());
+}
+
+void Scenario::ReportDurations(FILE* f, const char* name,
+                               const std::vector<Clock::duration>& durations) {
+  std::vector<long long> microseconds;
+  microseconds.reserve(durations.size());
+  for (Clock::duration d : durations) {
+    microseconds.push_back(
+        std::chrono::duration_cast<std::chrono::microseconds>(d).count());
+  }
+  ReportValues(f, name, "us", std::move(microseconds));
+}
+
+void Scenario::report(FILE* f) const {
+  fprintf(f, "{\"name\":\"");
+  for (const char* c = name(); *c != 0; c++) {
+    if (*c == '"' || *c == '\\') {
+      fputc('\\', f);
+    }
+    fputc(*c, f);
+  }
+  fprintf(f, "\",\"events\":%d,", numberOfEvents());
+  ReportDurations(f, "event_latency", m_eventLatencies);
+  fputc(',', f);
+  ReportDurations(f, "frame_time", m_frameTimes);
+  fputc(',', f);
+  ReportValues(f, "frame_pixels", "px", m_framePixels);
+  fputc('}', f);
+}
+
+/* The benchmark is replayed as a journal. The time an event is popped is the
+ * time the calculator received it. The event latency lasts until the first
+ * pixel pushed in response, or until the next event is requested if nothing is
+ * drawn. The frame time lasts from the first to the last pixel pushed in
+ * response to the event. The frame pixels count the pixels pushed in response
+ * to the event. */
+class BenchmarkJournal : public Journal {
+ public:
+  void init(int numberOfIterations) {
+    m_numberOfIterations = numberOfIterations;
+  }
+  void addScenario(Scenario&& scenario) {
+    m_scenarios.push_back(std::move(scenario));
+  }
+  bool hasScenarios() const { return !m_scenarios.empty(); }
+  void removeLastScenario() { m_scenarios.pop_back(); }
+  const std::vector<Scenario>& scenarios() const { return m_scenarios; }
+  int numberOfIterations() const { return m_numberOfIterations; }
+
+  // Used to load the scenarios
+  void pushEvent(Event e) override {
+    if (e != None) {
+      m_scenarios.back().pushEvent(e);
+    }
+  }
+  Event popEvent() override;
+  bool isEmpty() override;
+
+  void didPushRect(KDRect rect);
+
+ private:
+  void recordPendingEvent(Clock::time_point now);
+
+  std::vector<Scenario> m_scenarios;
+  int m_numberOfIterations = 1;
+  int m_scenarioIndex = 0;
+  int m_iteration = 0;
+  int m_eventIndex = 0;
+  int m_textIndex = 0;
+  Scenario* m_pendingScenario = nullptr;
+  Clock::time_point m_eventStart;
+  Clock::time_point m_firstPush;
+  Clock::time_point m_lastPush;
+  long long m_pushedPixels = 0;
+  bool m_hasPushed = false;
+};
+
+bool BenchmarkJournal::isEmpty() {
+  /* The simulator checks whether the journal is empty each time the calculator
+   * requests an event, which ends the pending event. */
+  recordPendingEvent(Clock::now());
+  return m_scenarioIndex >= static_cast<int>(m_scenarios.size());
+}
+
+Event BenchmarkJournal::popEvent() {
+  if (isEmpty()) {
+    return None;
+  }
+  Scenario* scenario = &m_scenarios[m_scenarioIndex];
+  while (m_eventIndex >= scenario->numberOfEvents()) {
+    // Skip empty scenarios
+    m_scenarioIndex++;
+    if (isEmpty()) {
+      return None;
+    }
+    scenario = &m_scenarios[m_scenarioIndex];
+  }
+  bool measured = scenario->isMeasured(m_eventIndex);
+  Event e = scenario->eventAtIndex(m_eventIndex++);
+  if (e == ExternalText) {
+    strlcpy(sharedExternalTextBuffer(), scenario->textAtIndex(m_textIndex++),
+            sharedExternalTextBufferSize);
+  }
+  if (m_eventIndex == scenario->numberOfEvents()) {
+    m_eventIndex = 0;
+    m_textIndex = 0;
+    if (++m_iteration == m_numberOfIterations) {
+      m_iteration = 0;
+      m_scenarioIndex++;
+    }
+  }
+  m_pendingScenario = measured ? scenario : nullptr;
+  m_hasPushed = false;
+  m_pushedPixels = 0;
+  m_eventStart = Clock::now();
+  return e;
+}
+
+void BenchmarkJournal::didPushRect(KDRect rect) {
+  if (m_pendingScenario == nullptr) {
+    return;
+  }
+  m_lastPush = Clock::now();
+  m_pushedPixels += static_cast<long long>(rect.width()) * rect.height();
+  if (!m_hasPushed) {
+    m_firstPush = m_lastPush;
+    m_hasPushed = true;
+  }
+}
+
+void BenchmarkJournal::recordPendingEvent(Clock::time_point now) {
+  if (m_pendingScenario == nullptr) {
+    return;
+  }
+  if (m_hasPushed) {
+    m_pendingScenario->addEventLatency(m_firstPush - m_eventStart);
+    m_pendingScenario->addFrameTime(m_lastPush - m_firstPush);
+  } else {
+    m_pendingScenario->addEventLatency(now - m_eventStart);
+  }
+  m_pendingScenario->addFramePixels(m_pushedPixels);
+  m_pendingScenario = nullptr;
+}
+
+static BenchmarkJournal sJournal;
+
+void init(const char* const* scenarioFiles, int numberOfScenarioFiles,
+          int numberOfIterations) {
+  sJournal.init(std::max(numberOfIterations, 1));
+#if ION_SIMULATOR_FILES
+  for (int i = 0; i < numberOfScenarioFiles; i++) {
+    sJournal.addScenario(Scenario(scenarioFiles[i]));
+    if (!StateFile::loadEvents(scenarioFiles[i], &sJournal)) {
+      fprintf(stderr, "Warning: unable to load scenario %s\n",
+              scenarioFiles[i]);
+      sJournal.removeLastScenario();
+    }
+  }
+#else
+  if (numberOfScenarioFiles > 0) {
+    fprintf(stderr, "Warning: scenario files are not supported\n");
+  }
+#endif
+  if (!sJournal.hasScenarios()) {
+    sJournal.addScenario(Scenario("Calc scrolling", scenarioCalculation));
+    sJournal.addScenario(Scenario("Sin/Cos graph", scenarioFunctionCosSin));
+    sJournal.addScenario(Scenario("Mandelbrot(15)", scenarioPythonMandelbrot));
+    sJournal.addScenario(Scenario("Statistics", scenarioStatistics));
+    sJournal.addScenario(Scenario("Probability", scenarioProbability));
+    sJournal.addScenario(Scenario("Equation", scenarioEquation));
+    sJournal.addScenario(Scenario("History scrolling", scenarioScrolling,
+                                  k_scrollingSetupLength,
+                                  k_scrollingTeardownLength));
+    sJournal.addScenario(Scenario("Script scrolling", scenarioScriptScrolling,
+                                  k_scriptScrollingSetupLength,
+                                  k_scriptScrollingTeardownLength));
+  }
+  replayFrom(&sJournal);
+}
+
+void didPushRect(KDRect rect) { sJournal.didPushRect(rect); }
+
+void report() {
+  FILE* f = stdout;
+  fprintf(f, "{\"iterations\":%d,\"scenarios\":[",
+          sJournal.numberOfIterations());
+  bool first = true;
+  for (const Scenario& scenario : sJournal.scenarios()) {
+    if (!first) {
+      fputc(',', f);
+    }
+    first = false;
+    scenario.report(f);
+  }
+  fprintf(f, "]}\n");
+  fflush(f);
+}
+
+}  // namespace EventsBenchmark
+}  // namespace Simulator
+}  // namespace Ion
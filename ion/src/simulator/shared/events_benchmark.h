@@ -0,0 +1,25 @@
+#ifndef ION_SIMULATOR_EVENTS_BENCHMARK_H
+#define ION_SIMULATOR_EVENTS_BENCHMARK_H
+
+#include <kandinsky/rect.h>
+
+namespace Ion {
+namespace Simulator {
+namespace EventsBenchmark {
+
+/* Replay each scenario numberOfIterations times and time how the calculator
+ * responds to its events. A scenario is a state file, the built-in scenarios
+ * are used if none is given. The state of the calculator is kept from one
+ * iteration to the next, so scenarios should end on the home screen. */
+void init(const char* const* scenarioFiles, int numberOfScenarioFiles,
+          int numberOfIterations);
+// Called by the display each time pixels are pushed
+void didPushRect(KDRect rect);
+// Print the timings of each scenario as a JSON line on stdout
+void report();
+
+}  // namespace EventsBenchmark
+}  // namespace Simulator
+}  // namespace Ion
+
+#endif
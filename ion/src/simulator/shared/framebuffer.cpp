@@ -5,6 +5,9 @@
 #include <kandinsky/framebuffer.h>
 
 #include "window.h"
+#if ION_EVENTS_BENCHMARK
+#include "events_benchmark.h"
+#endif
 
 /* Drawing on an SDL texture
  * In SDL2, drawing bitmap data happens through textures, whose data lives in
@@ -40,6 +43,9 @@ static IntializedFrameBuffer sFrameBuffer =
     IntializedFrameBuffer(sPixels, KDSize(WidthWithBorder, HeightWithBorder));
 
 void pushRect(KDRect r, const KDColor* pixels) {
+#if ION_EVENTS_BENCHMARK
+  Simulator::EventsBenchmark::didPushRect(r);
+#endif
   if (sFrameBufferActive) {
     Simulator::Window::setNeedsRefresh();
     sFrameBuffer.pushRect(r.translatedBy(k_frameOrigin), pixels);
@@ -47,12 +53,28 @@ void pushRect(KDRect r, const KDColor* pixels) {
 }
 
 void pushRectUniform(KDRect r, KDColor c) {
+#if ION_EVENTS_BENCHMARK
+  Simulator::EventsBenchmark::didPushRect(r);
+#endif
   if (sFrameBufferActive) {
     Simulator::Window::setNeedsRefresh();
     sFrameBuffer.pushRectUniform(r.translatedBy(k_frameOrigin), c);
   }
 }
 
+bool copyRect(KDRect r, KDPoint destination) {
+#if ION_EVENTS_BENCHMARK
+  // No pixel is pushed, but the copy is part of the frame
+  Simulator::EventsBenchmark::didPushRect(KDRectZero);
+#endif
+  if (sFrameBufferActive) {
+    Simulator::Window::setNeedsRefresh();
+    sFrameBuffer.copyRect(r.translatedBy(k_frameOrigin),
+                          destination.translatedBy(k_frameOrigin));
+  }
+  return true;
+}
+
 void pullRect(KDRect r, KDColor* pixels) {
   if (sFrameBufferActive) {
     sFrameBuffer.pullRect(r.translatedBy(k_frameOrigin), pixels);
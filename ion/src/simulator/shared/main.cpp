@@ -11,6 +11,9 @@
 #include <array>
 #include <vector>
 
+#if ION_EVENTS_BENCHMARK
+#include "events_benchmark.h"
+#endif
 #include "haptics.h"
 #include "journal.h"
 #include "platform.h"
@@ -44,6 +47,12 @@ constexpr static const char* k_loadStateFileKeys[] = {"--load-state-file",
 constexpr static const char* k_headlessFlags[] = {"--headless", "-h"};
 constexpr static const char* k_languageFlag = "--language";
 constexpr static const char* k_limitStackUsageFlag = "--limit-stack-usage";
+#if ION_EVENTS_BENCHMARK
+constexpr static const char* k_benchmarkScenarioKey = "--benchmark-scenario";
+constexpr static const char* k_benchmarkIterationsKey =
+    "--benchmark-iterations";
+constexpr static int k_defaultBenchmarkIterations = 10;
+#endif
 
 /* The Args class allows parsing and editing command-line arguments
  * The editing part allows us to add/remove arguments before forwarding them to
@@ -285,6 +294,17 @@ int main(int argc, char* argv[]) {
 
   bool headless = args.popFlags(k_headlessFlags, std::size(k_headlessFlags));
 
+#if ION_EVENTS_BENCHMARK
+  std::vector<const char*> benchmarkScenarios;
+  while (const char* scenario = args.pop(k_benchmarkScenarioKey)) {
+    benchmarkScenarios.push_back(scenario);
+  }
+  const char* benchmarkIterations = args.pop(k_benchmarkIterationsKey);
+  EventsBenchmark::init(benchmarkScenarios.data(), benchmarkScenarios.size(),
+                        benchmarkIterations ? atoi(benchmarkIterations)
+                                            : k_defaultBenchmarkIterations);
+#endif
+
   Random::init();
   if (!headless) {
     Journal::init();
@@ -332,6 +352,9 @@ int main(int argc, char* argv[]) {
     ion_main(args.argc(), args.argv());
 #if ION_SIMULATOR_EXTERNAL_APP
   }
+#endif
+#if ION_EVENTS_BENCHMARK
+  EventsBenchmark::report();
 #endif
   if (!headless) {
     Haptics::shutdown();
@@ -31,7 +31,8 @@ constexpr static size_t sHeaderLength =
  * + EVENTS...
  */
 
-static inline bool loadFileHeader(const char* header) {
+static inline bool loadFileHeader(const char* header,
+                                  Ion::Events::Journal* journal) {
   const char* magic = header;
   const char* version = magic + sMagicLength;
   const char* formatVersion = version + sVersionLength;
@@ -48,7 +49,7 @@ static inline bool loadFileHeader(const char* header) {
     return false;
   }
   if (strncmp(language, sWildcardLanguage, sLanguageLength) != 0) {
-    Journal::replayJournal()->setStartingLanguage(language);
+    journal->setStartingLanguage(language);
   }
   return true;
 }
@@ -69,7 +70,8 @@ static inline Ion::Events::Event reconstructEvent(uint8_t c) {
   return e;
 }
 
-static inline void pushEventFromFile(uint8_t c, FILE* f) {
+static inline void pushEventFromFile(uint8_t c, FILE* f,
+                                     Ion::Events::Journal* journal) {
   Ion::Events::Event e = reconstructEvent(c);
   if (e == Ion::Events::None) {
     return;
@@ -90,15 +92,16 @@ static inline void pushEventFromFile(uint8_t c, FILE* f) {
          * chunks */
         buffer[i] = 0;
         i = 0;
-        Journal::replayJournal()->pushEvent(e);
+        journal->pushEvent(e);
       }
     }
   }
-  Journal::replayJournal()->pushEvent(e);
+  journal->pushEvent(e);
 }
 
 static inline void pushEventFromMemory(uint8_t c, const uint8_t* ptr,
-                                       const uint8_t* bufferEnd) {
+                                       const uint8_t* bufferEnd,
+                                       Ion::Events::Journal* journal) {
   Ion::Events::Event e = reconstructEvent(c);
   if (e == Ion::Events::None) {
     return;
@@ -119,35 +122,34 @@ static inline void pushEventFromMemory(uint8_t c, const uint8_t* ptr,
          * chunks */
         buffer[i] = 0;
         i = 0;
-        Journal::replayJournal()->pushEvent(e);
+        journal->pushEvent(e);
       }
     }
   }
-  Journal::replayJournal()->pushEvent(e);
+  journal->pushEvent(e);
 }
-static inline bool loadFile(FILE* f, bool headlessStateFile) {
+static inline bool loadFile(FILE* f, bool headlessStateFile,
+                            Ion::Events::Journal* journal) {
   if (!headlessStateFile) {
     char header[sHeaderLength + 1];
     header[sHeaderLength] = 0;
     if (fread(header, sHeaderLength, 1, f) != 1) {
       return false;
     }
-    if (!loadFileHeader(header)) {
+    if (!loadFileHeader(header, journal)) {
       return false;
     }
   }
   // Events
   int c = 0;
   while ((c = getc(f)) != EOF) {
-    pushEventFromFile(c, f);
+    pushEventFromFile(c, f, journal);
   }
-
-  Ion::Events::replayFrom(Journal::replayJournal());
-
   return true;
 }
 
-void load(const char* filename, bool headlessStateFile) {
+bool loadEvents(const char* filename, Ion::Events::Journal* journal,
+                bool headlessStateFile) {
   FILE* f = nullptr;
   if (strcmp(filename, "-") == 0) {
     f = stdin;
@@ -155,12 +157,19 @@ void load(const char* filename, bool headlessStateFile) {
     f = fopen(filename, "rb");
   }
   if (f == nullptr) {
-    return;
+    return false;
   }
-  loadFile(f, headlessStateFile);
+  bool result = loadFile(f, headlessStateFile, journal);
   if (f != stdin) {
     fclose(f);
   }
+  return result;
+}
+
+void load(const char* filename, bool headlessStateFile) {
+  if (loadEvents(filename, Journal::replayJournal(), headlessStateFile)) {
+    Ion::Events::replayFrom(Journal::replayJournal());
+  }
 }
 
 void loadMemory(const char* buffer, size_t length, bool headlessStateFile) {
@@ -171,7 +180,7 @@ void loadMemory(const char* buffer, size_t length, bool headlessStateFile) {
     if (length < sHeaderLength) {
       return;
     }
-    if (!loadFileHeader(buffer)) {
+    if (!loadFileHeader(buffer, Journal::replayJournal())) {
       return;
     }
     e = reinterpret_cast<const uint8_t*>(buffer + sHeaderLength);
@@ -179,7 +188,7 @@ void loadMemory(const char* buffer, size_t length, bool headlessStateFile) {
   const uint8_t* bufferEnd = reinterpret_cast<const uint8_t*>(buffer + length);
   while (e < bufferEnd) {
     uint8_t ch = *e;
-    pushEventFromMemory(ch, e++, bufferEnd);
+    pushEventFromMemory(ch, e++, bufferEnd, Journal::replayJournal());
   }
   Ion::Events::replayFrom(Journal::replayJournal());
 }
@@ -1,11 +1,18 @@
 #ifndef ION_SIMULATOR_STATE_FILE_H
 #define ION_SIMULATOR_STATE_FILE_H
 
+#include <ion/events.h>
+#include <stddef.h>
+
 namespace Ion {
 namespace Simulator {
 namespace StateFile {
 
 void load(const char* filename, bool headlessStateFile = false);
+/* Push the events of the state file into the journal without replaying them.
+ * Return false if the file cannot be read or has an invalid header. */
+bool loadEvents(const char* filename, Ion::Events::Journal* journal,
+                bool headlessStateFile = false);
 bool loadMemory(const char* buffer, size_t length,
                 bool headlessStateFiles = false);
 void save(const char* filename);
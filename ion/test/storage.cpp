@@ -2,6 +2,7 @@
 #include <ion/storage/file_system.h>
 #include <omg/print.h>
 #include <quiz.h>
+#include <quiz/stopwatch.h>
 #include <string.h>
 
 using namespace Ion;
@@ -835,3 +836,172 @@ QUIZ_CASE(ion_storage_disabled_records) {
       Storage::FileSystem::sharedFileSystem->numberOfRecordsWithExtension(
           Storage::systemExtension));
 }
+
+constexpr size_t k_testRecordNameSize = 10;
+
+// The i-th test record is named ri.exp and contains "ri"
+static void nameOfTestRecord(int i, char* buffer) {
+  buffer[0] = 'r';
+  size_t length = OMG::Print::IntLeft(i, buffer + 1, k_testRecordNameSize - 1);
+  buffer[length + 1] = 0;
+}
+
+static void fillStorageWithRecords(int numberOfRecords) {
+  char name[k_testRecordNameSize];
+  for (int i = 0; i < numberOfRecords; i++) {
+    nameOfTestRecord(i, name);
+    createTestRecordWithErrorStatus(name, Storage::expressionExtension, name);
+  }
+}
+
+static bool recordsAreIntact(int numberOfRecords, bool (*exists)(int i)) {
+  char name[k_testRecordNameSize];
+  for (int i = 0; i < numberOfRecords; i++) {
+    nameOfTestRecord(i, name);
+    Storage::Record record = getRecord(name, Storage::expressionExtension);
+    if (record.isNull() != !exists(i) ||
+        (exists(i) && !isDataOfRecord(name, Storage::expressionExtension,
+                                      name))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+QUIZ_CASE(ion_storage_many_records) {
+  /* Below and above the number of records that can be indexed, both lookups
+   * must find the same records when the buffer changes. */
+  constexpr int k_numbersOfRecords[] = {200, 240};
+  for (int n : k_numbersOfRecords) {
+    fillStorageWithRecords(n);
+    quiz_assert(recordsAreIntact(n, [](int i) { return true; }));
+
+    // Destroy some records to slide the others
+    char name[k_testRecordNameSize];
+    for (int i = 0; i < n; i += 3) {
+      nameOfTestRecord(i, name);
+      getRecord(name, Storage::expressionExtension).destroy();
+    }
+    quiz_assert(recordsAreIntact(n, [](int i) { return i % 3 != 0; }));
+
+    // Rename a record and change the value of another one
+    Storage::Record record = getRecord("r1", Storage::expressionExtension);
+    quiz_assert(Storage::Record::SetBaseNameWithExtension(
+                    &record, "renamed", Storage::expressionExtension) ==
+                Storage::Record::ErrorStatus::None);
+    quiz_assert(getRecord("r1", Storage::expressionExtension).isNull());
+    quiz_assert(isDataOfRecord("renamed", Storage::expressionExtension, "r1"));
+    quiz_assert(getRecord("r2", Storage::expressionExtension)
+                    .setValue({.buffer = "longer value", .size = 13}) ==
+                Storage::Record::ErrorStatus::None);
+    quiz_assert(isDataOfRecord("r2", Storage::expressionExtension,
+                               "longer value"));
+    quiz_assert(isDataOfRecord("r4", Storage::expressionExtension, "r4"));
+    quiz_assert(isDataOfRecord("r5", Storage::expressionExtension, "r5"));
+
+    Storage::FileSystem::sharedFileSystem->destroyAllRecords();
+    quiz_assert(
+        Storage::FileSystem::sharedFileSystem->numberOfRecordsWithExtension(
+            Storage::expressionExtension) == 0);
+  }
+}
+
+QUIZ_CASE(ion_storage_benchmark_lookups) {
+  constexpr int k_numberOfRecords = 210;
+  constexpr int k_numberOfPasses = 100;
+  fillStorageWithRecords(k_numberOfRecords);
+  uint64_t startTime = quiz_stopwatch_start();
+  int numberOfRecordsFound = 0;
+  char name[k_testRecordNameSize];
+  for (int pass = 0; pass < k_numberOfPasses; pass++) {
+    for (int i = 0; i < k_numberOfRecords; i++) {
+      nameOfTestRecord(i, name);
+      numberOfRecordsFound +=
+          !getRecord(name, Storage::expressionExtension).isNull();
+    }
+  }
+  quiz_stopwatch_print_lap(startTime);
+  quiz_assert(numberOfRecordsFound == k_numberOfRecords * k_numberOfPasses);
+  Storage::FileSystem::sharedFileSystem->destroyAllRecords();
+}
+
+static bool recordsWithExtensionAre(const char* extension,
+                                    const char* const* baseNames,
+                                    int numberOfBaseNames) {
+  if (Storage::FileSystem::sharedFileSystem->numberOfRecordsWithExtension(
+          extension) != numberOfBaseNames) {
+    return false;
+  }
+  for (int i = 0; i <= numberOfBaseNames; i++) {
+    Storage::Record record =
+        Storage::FileSystem::sharedFileSystem->recordWithExtensionAtIndex(
+            extension, i);
+    if (i == numberOfBaseNames) {
+      return record.isNull();
+    }
+    if (record != getRecord(baseNames[i], extension)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+QUIZ_CASE(ion_storage_records_with_extension_at_index) {
+  const char* extension = Storage::functionExtension;
+  const char* otherExtension = Storage::expressionExtension;
+  createTestRecordWithErrorStatus("f", extension);
+  createTestRecordWithErrorStatus("a", otherExtension);
+  createTestRecordWithErrorStatus("g", extension);
+  createTestRecordWithErrorStatus("h", extension);
+  createTestRecordWithErrorStatus("b", otherExtension);
+  createTestRecordWithErrorStatus("k", extension);
+  {
+    const char* names[] = {"f", "g", "h", "k"};
+    quiz_assert(recordsWithExtensionAre(extension, names, 4));
+    const char* otherNames[] = {"a", "b"};
+    quiz_assert(recordsWithExtensionAre(otherExtension, otherNames, 2));
+  }
+
+  // Enumerating backwards or skipping records restarts from the right record
+  Storage::FileSystem* fileSystem = Storage::FileSystem::sharedFileSystem;
+  quiz_assert(fileSystem->recordWithExtensionAtIndex(extension, 3) ==
+              getRecord("k", extension));
+  quiz_assert(fileSystem->recordWithExtensionAtIndex(extension, 1) ==
+              getRecord("g", extension));
+  quiz_assert(fileSystem->recordWithExtensionAtIndexStartingWithout(
+                  'g', extension, 1) == getRecord("h", extension));
+  quiz_assert(fileSystem->recordWithExtensionAtIndexStartingWithout(
+                  'f', extension, 1) == getRecord("h", extension));
+  quiz_assert(fileSystem->recordWithExtensionAtIndexStartingWithout(
+                  'h', extension, 1) == getRecord("g", extension));
+  quiz_assert(fileSystem->numberOfRecordsStartingWithout('h', extension) ==
+              3);
+
+  // Destroy and rename records between enumerations
+  getRecord("g", extension).destroy();
+  {
+    const char* names[] = {"f", "h", "k"};
+    quiz_assert(recordsWithExtensionAre(extension, names, 3));
+  }
+  Storage::Record record = getRecord("h", extension);
+  quiz_assert(Storage::Record::SetBaseNameWithExtension(
+                  &record, "b2", otherExtension) ==
+              Storage::Record::ErrorStatus::None);
+  {
+    const char* names[] = {"f", "k"};
+    quiz_assert(recordsWithExtensionAre(extension, names, 2));
+    const char* otherNames[] = {"a", "b2", "b"};
+    quiz_assert(recordsWithExtensionAre(otherExtension, otherNames, 3));
+  }
+  record = getRecord("f", extension);
+  quiz_assert(Storage::Record::SetBaseNameWithExtension(&record, "longer",
+                                                        extension) ==
+              Storage::Record::ErrorStatus::None);
+  createTestRecordWithErrorStatus("m", extension);
+  {
+    const char* names[] = {"longer", "k", "m"};
+    quiz_assert(recordsWithExtensionAre(extension, names, 3));
+  }
+  fileSystem->destroyAllRecords();
+  quiz_assert(fileSystem->recordWithExtensionAtIndex(extension, 0).isNull());
+}
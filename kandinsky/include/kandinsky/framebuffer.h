@@ -10,6 +10,8 @@ class KDFrameBuffer {
   void pushRect(KDRect rect, const KDColor* pixels);
   void pushRectUniform(KDRect rect, KDColor color);
   void pullRect(KDRect rect, KDColor* pixels);
+  // The source and destination rects may overlap
+  void copyRect(KDRect source, KDPoint destination);
   KDRect bounds();
 
  private:
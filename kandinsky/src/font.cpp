@@ -5,11 +5,35 @@ extern "C" {
 #include <assert.h>
 #include <omg/memory.h>
 #include <omg/utf8_decoder.h>
+#include <string.h>
 
 #include <algorithm>
 
 constexpr static int k_tabCharacterWidth = 4;
 
+/* Decompressing a glyph costs much more than copying it, and strings are
+ * mostly made of the same few glyphs. Recently used glyphs are thus kept
+ * decompressed in a 2-way set associative cache: a glyph can only be cached in
+ * the two ways of the set of its index, the least recently used one being
+ * replaced on a miss. */
+constexpr static int k_numberOfGlyphCacheSets = 32;
+constexpr static int k_numberOfGlyphCacheWays = 2;
+constexpr static int k_maxGlyphGrayscalesSize =
+    KDFont::k_maxGlyphPixelCount * k_grayscaleBitsPerPixel / 8;
+
+struct CachedGlyph {
+  const KDFont* font;
+  KDFont::GlyphIndex index;
+  uint8_t grayscales[k_maxGlyphGrayscalesSize];
+};
+
+struct GlyphCacheSet {
+  CachedGlyph ways[k_numberOfGlyphCacheWays];
+  uint8_t leastRecentlyUsedWay;
+};
+
+static GlyphCacheSet s_glyphCache[k_numberOfGlyphCacheSets];
+
 #if KANDINSKY_FONT_VARIABLE_WIDTH
 KDCoordinate KDFont::GlyphWidth(Size size, CodePoint codePoint) {
   int index = Font(size)->indexForCodePoint(codePoint);
@@ -79,10 +103,32 @@ void KDFont::accumulateGlyphGrayscalesForCodePoint(
 
 void KDFont::fetchGrayscaleGlyphAtIndex(KDFont::GlyphIndex index,
                                         uint8_t* grayscaleBuffer) const {
-  OMG::Memory::Decompress(
-      compressedGlyphData(index), grayscaleBuffer,
-      compressedGlyphDataSize(index),
-      m_glyphSize.width() * m_glyphSize.height() * k_grayscaleBitsPerPixel / 8);
+  int size =
+      m_glyphSize.width() * m_glyphSize.height() * k_grayscaleBitsPerPixel / 8;
+  assert(size <= k_maxGlyphGrayscalesSize);
+  // Offset the sets of the small font so that both fonts share the cache
+  int setIndex = (index + (this == &privateSmallFont
+                               ? k_numberOfGlyphCacheSets / 2
+                               : 0)) %
+                 k_numberOfGlyphCacheSets;
+  GlyphCacheSet* set = &s_glyphCache[setIndex];
+  static_assert(k_numberOfGlyphCacheWays == 2);
+  for (int way = 0; way < k_numberOfGlyphCacheWays; way++) {
+    CachedGlyph* glyph = &set->ways[way];
+    if (glyph->font == this && glyph->index == index) {
+      set->leastRecentlyUsedWay = 1 - way;
+      memcpy(grayscaleBuffer, glyph->grayscales, size);
+      return;
+    }
+  }
+  int way = set->leastRecentlyUsedWay;
+  CachedGlyph* glyph = &set->ways[way];
+  OMG::Memory::Decompress(compressedGlyphData(index), glyph->grayscales,
+                          compressedGlyphDataSize(index), size);
+  glyph->font = this;
+  glyph->index = index;
+  set->leastRecentlyUsedWay = 1 - way;
+  memcpy(grayscaleBuffer, glyph->grayscales, size);
 }
 
 void KDFont::colorizeGlyphBuffer(const RenderPalette* renderPalette,
@@ -117,29 +163,39 @@ void KDFont::colorizeGlyphBuffer(const RenderPalette* renderPalette,
 }
 
 KDFont::GlyphIndex KDFont::indexForCodePoint(CodePoint c) const {
-  const CodePointIndexPair* currentPair = s_CodePointToGlyphIndex;
+  const CodePointIndexPair* firstPair = s_CodePointToGlyphIndex;
   const CodePointIndexPair* endPair =
-      &s_CodePointToGlyphIndex[s_codePointPairsTableLength - 1];
-  if (c < currentPair->codePoint()) {
-    goto NoMatchingGlyph;
+      s_CodePointToGlyphIndex + s_codePointPairsTableLength;
+  // Most code points are ASCII, which is the first series of code points
+  assert(s_codePointPairsTableLength > 1);
+  if (c >= firstPair->codePoint() &&
+      c - firstPair->codePoint() <
+          static_cast<uint32_t>(firstPair[1].glyphIndex() -
+                                firstPair->glyphIndex())) {
+    return firstPair->glyphIndex() + (c - firstPair->codePoint());
   }
-  while (currentPair < endPair) {
-    const CodePointIndexPair* nextPair = currentPair + 1;
-    if (c < nextPair->codePoint()) {
+  /* Find the last pair starting before c with a binary search. Its series of
+   * consecutive code points ends right before the glyph of the next pair. */
+  const CodePointIndexPair* nextPair = std::upper_bound(
+      firstPair, endPair, c,
+      [](CodePoint c, const CodePointIndexPair& pair) {
+        return c < pair.codePoint();
+      });
+  if (nextPair != firstPair) {
+    const CodePointIndexPair* currentPair = nextPair - 1;
+    if (nextPair == endPair) {
+      if (currentPair->codePoint() == c) {
+        return currentPair->glyphIndex();
+      }
+    } else {
       CodePoint lastCodePointOfCurrentPair =
           currentPair->codePoint() +
           (nextPair->glyphIndex() - currentPair->glyphIndex() - 1);
-      if (c > lastCodePointOfCurrentPair) {
-        goto NoMatchingGlyph;
+      if (c <= lastCodePointOfCurrentPair) {
+        return currentPair->glyphIndex() + (c - currentPair->codePoint());
       }
-      return currentPair->glyphIndex() + (c - currentPair->codePoint());
     }
-    currentPair = nextPair;
-  }
-  if (endPair->codePoint() == c) {
-    return endPair->glyphIndex();
   }
-NoMatchingGlyph:
   assert(CodePoints[k_indexForReplacementCharacterCodePoint] == 0xFFFD);
   return k_indexForReplacementCharacterCodePoint;
 }
@@ -51,3 +51,19 @@ void KDFrameBuffer::pullRect(KDRect rect, KDColor* pixels) {
     line += rect.width();
   }
 }
+
+void KDFrameBuffer::copyRect(KDRect source, KDPoint destination) {
+  assert(source.isValid());
+  assert(bounds().containsRect(source) &&
+         bounds().containsRect(KDRect(destination, source.size())));
+  /* Copy the lines in the order that does not overwrite the source before it
+   * is read. */
+  bool bottomUp = destination.y() > source.y();
+  for (KDCoordinate j = 0; j < source.height(); j++) {
+    KDCoordinate line = bottomUp ? source.height() - 1 - j : j;
+    KDPoint lineOffset = KDPoint(0, line);
+    memmove(pixelAddress(destination.translatedBy(lineOffset)),
+            pixelAddress(source.origin().translatedBy(lineOffset)),
+            source.width() * sizeof(KDColor));
+  }
+}
@@ -1,7 +1,12 @@
 #include <assert.h>
+#include <kandinsky/context.h>
 #include <kandinsky/font.h>
 #include <kandinsky/fonts/code_points.h>
+#include <kandinsky/framebuffer.h>
 #include <quiz.h>
+#include <quiz/stopwatch.h>
+
+#include <iterator>
 
 constexpr KDFont testFont(10, 10, nullptr, nullptr);
 
@@ -26,3 +31,44 @@ QUIZ_CASE(kandinsky_font_index_for_code_point) {
                  valueNotInArray(CodePoints, NumberOfCodePoints, codePoint)));
   }
 }
+
+class FrameBufferContext : public KDContext {
+ public:
+  FrameBufferContext(KDFrameBuffer* frameBuffer)
+      : KDContext(KDPointZero, frameBuffer->bounds()),
+        m_frameBuffer(frameBuffer) {}
+
+ private:
+  void pushRect(KDRect rect, const KDColor* pixels) override {
+    m_frameBuffer->pushRect(rect, pixels);
+  }
+  void pushRectUniform(KDRect rect, KDColor color) override {
+    m_frameBuffer->pushRectUniform(rect, color);
+  }
+  void pullRect(KDRect rect, KDColor* pixels) override {
+    m_frameBuffer->pullRect(rect, pixels);
+  }
+  KDFrameBuffer* m_frameBuffer;
+};
+
+QUIZ_CASE(kandinsky_draw_string_benchmark) {
+  constexpr KDSize k_size(320, 240);
+  static KDColor pixels[k_size.width() * k_size.height()];
+  KDFrameBuffer frameBuffer(pixels, k_size);
+  FrameBufferContext context(&frameBuffer);
+  constexpr const char* k_lines[] = {
+      "1+2*3-sin(π/4)=0.2928932188",
+      "for i in range(10):",
+      "    print(i, i**2)",
+      "ℯ^(-x^2/2)≈0.6065306597",
+  };
+  constexpr int k_numberOfDraws = 4000;
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int i = 0; i < k_numberOfDraws; i++) {
+    const char* line = k_lines[i % std::size(k_lines)];
+    KDFont::Size font = i % 2 ? KDFont::Size::Small : KDFont::Size::Large;
+    KDPoint position(0, (i * KDFont::GlyphHeight(font)) % k_size.height());
+    context.drawString(line, position, {.font = font});
+  }
+  quiz_stopwatch_print_lap(startTime);
+}
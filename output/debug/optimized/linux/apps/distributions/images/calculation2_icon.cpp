@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "calculation2_icon.h"
+
+// Compressed 897 pixels into 564 bytes (20.96% compression ratio)/
+const uint8_t compressedPixelData[564] = {0x1f, 0xff, 0x01, 0x00, 0xac, 0x8f, 0x14, 0xff, 0x06, 0xfe, 0xe5, 0xfd, 0xd1, 0xfe, 0x4c, 0x00, 0x33, 0x9f, 0xe6, 0xfd, 0xe6, 0xfd, 0xe4, 0xfd, 0x07, 0xfe, 0x8d, 0x50, 0x00, 0x2e, 0x53, 0x9a, 0xff, 0xc4, 0xfd, 0xc3, 0x02, 0x00, 0x3f, 0xe6, 0xfd, 0xf2, 0x50, 0x00, 0x2c, 0x46, 0x28, 0xfe, 0xc3, 0xfd, 0x02, 0x00, 0x3f, 0xc4, 0xfd, 0xbc, 0x4c, 0x00, 0x28, 0x17, 0x57, 0x9a, 0x00, 0x00, 0x02, 0x00, 0x3f, 0x06, 0xfe, 0x6c, 0x9e, 0x00, 0x28, 0x19, 0x4a, 0x9a, 0x00, 0x02, 0xee, 0x00, 0x1f, 0x9a, 0x34, 0x01, 0x26, 0x1d, 0x06, 0x4e, 0x00, 0x2f, 0xc5, 0xf5, 0x9e, 0x00, 0x25, 0x4c, 0x8e, 0xfe, 0xbc, 0xff, 0x4e, 0x00, 0x5f, 0xde, 0xff, 0xe5, 0xfd, 0xbb, 0x4c, 0x00, 0x20, 0x5d, 0xdd, 0xff, 0xe5, 0xfd, 0xde, 0x4e, 0x00, 0x5f, 0xff, 0xff, 0xd1, 0xfe, 0xaf, 0x9e, 0x00, 0x20, 0x11, 0xf3, 0x60, 0x02, 0x0e, 0x4e, 0x00, 0x11, 0xbc, 0x66, 0x00, 0x0f, 0x01, 0x00, 0x1d, 0x4e, 0x07, 0xfe, 0x9a, 0xff, 0x4e, 0x00, 0x00, 0x1a, 0x00, 0x3f, 0x6c, 0xfe, 0x13, 0x1c, 0x02, 0x1e, 0x3f, 0x4a, 0xfe, 0xff, 0x4e, 0x00, 0x04, 0x3f, 0x78, 0xff, 0x07, 0xec, 0x00, 0x1c, 0x4f, 0x4b, 0xfe, 0x56, 0xff, 0x4e, 0x00, 0x05, 0x00, 0xd4, 0x02, 0x1f, 0x57, 0x1c, 0x02, 0x1a, 0x04, 0x7e, 0x00, 0x0e, 0x4e, 0x00, 0x02, 0xbc, 0x03, 0x2f, 0x6b, 0xfe, 0xb6, 0x02, 0x19, 0x2f, 0x14, 0xff, 0x4e, 0x00, 0x09, 0x2f, 0xfe, 0xff, 0xc6, 0x02, 0x17, 0x5f, 0xf2, 0xfe, 0x29, 0xfe, 0xff, 0x4e, 0x00, 0x0a, 0x0f, 0x9e, 0x00, 0x15, 0x8f, 0x79, 0xff, 0x4a, 0xfe, 0x28, 0xfe, 0xbc, 0xff, 0x4e, 0x00, 0x0d, 0x00, 0x3c, 0x01, 0x0e, 0x52, 0x04, 0x0a, 0x4a, 0x00, 0x4a, 0x6c, 0xfe, 0xe5, 0xfd, 0xfe, 0x01, 0x0f, 0x4e, 0x00, 0x07, 0x7f, 0xbc, 0xff, 0x28, 0xfe, 0x6c, 0xfe, 0x9b, 0x4a, 0x00, 0x02, 0x8c, 0xd1, 0xfe, 0x28, 0xfe, 0x07, 0xfe, 0x13, 0xff, 0x6f, 0x00, 0x0e, 0x4e, 0x00, 0x0a, 0x14, 0x01, 0x5d, 0x07, 0xfe, 0x6b, 0xfe, 0x14, 0x4e, 0x00, 0x3f, 0xfe, 0xff, 0xde, 0x42, 0x06, 0x7e, 0x1f, 0x00, 0x01, 0x00, 0x4c, 0x5f, 0x64, 0xe0, 0xe9, 0x7e, 0x03, 0x26, 0x00, 0x0e, 0x7f, 0x69, 0xe5, 0xe4, 0xf0, 0xd9, 0xa4, 0x01, 0x26, 0x00, 0x0c, 0x20, 0x30, 0xf2, 0xb2, 0x00, 0x2f, 0xe5, 0x73, 0x27, 0x00, 0x0c, 0x11, 0xce, 0x8f, 0x01, 0x3f, 0xfd, 0xf1, 0x22, 0x26, 0x00, 0x0a, 0x22, 0x49, 0xf6, 0x01, 0x01, 0x2f, 0xdf, 0xaa, 0x27, 0x00, 0x0a, 0x14, 0xc1, 0x29, 0x01, 0x2f, 0xe5, 0x33, 0x26, 0x00, 0x08, 0x25, 0x32, 0xe1, 0x51, 0x01, 0x1f, 0xad, 0x27, 0x00, 0x08, 0x24, 0x9d, 0x21, 0x26, 0x00, 0x3f, 0x0b, 0xe9, 0x24, 0x26, 0x00, 0x06, 0x35, 0x12, 0xed, 0x0f, 0x9e, 0x01, 0x2f, 0x83, 0x91, 0x27, 0x00, 0x06, 0x35, 0x72, 0xa1, 0x00, 0x27, 0x00, 0x3f, 0x1e, 0xeb, 0x0c, 0x26, 0x00, 0x04, 0x46, 0x01, 0xda, 0x31, 0x00, 0xec, 0x01, 0x2f, 0xa9, 0x6d, 0x27, 0x00, 0x04, 0x37, 0x47, 0xbf, 0x00, 0x27, 0x00, 0x2f, 0x3e, 0xd6, 0x8b, 0x01, 0x04, 0x28, 0xb8, 0x4f, 0x27, 0x00, 0x3f, 0x00, 0xce, 0x47, 0x26, 0x00, 0x02, 0x39, 0x33, 0xda, 0x02, 0x27, 0x00, 0x2f, 0x62, 0xb3, 0x27, 0x00, 0x02, 0x39, 0xc0, 0x67, 0x00, 0x27, 0x00, 0x4e, 0x09, 0xe3, 0x2d, 0x00, 0x01, 0x00, 0x3a, 0x76, 0xc8, 0x03, 0x27, 0x00, 0x3d, 0x00, 0x65, 0xb4, 0x25, 0x00, 0x5b, 0x36, 0xbc, 0xd3, 0x1c, 0x00, 0x27, 0x00, 0x3a, 0x04, 0xcf, 0x79, 0x25, 0x00, 0x6c, 0x3b, 0xb0, 0xe8, 0x6a, 0x06, 0x00, 0x27, 0x00, 0x55, 0x00, 0x1c, 0xd3, 0xad, 0x28, 0x24, 0x00, 0x63, 0x07, 0x7e, 0xd1, 0xd6, 0x6e, 0x0a, 0x0d, 0x00, 0x0a, 0x24, 0x03, 0x54, 0x07, 0x77, 0xdb, 0xb4, 0x67, 0x28, 0x00, 0x2f, 0x09, 0x0d, 0xad, 0x02, 0x07, 0x3f, 0x01, 0x02, 0x02, 0x1c, 0x03, 0x13, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+constexpr Escher::Image image = Escher::Image(39, 23, compressedPixelData, 564, true);
+
+const Escher::Image * const ImageStore::Calculation2Icon = &image;
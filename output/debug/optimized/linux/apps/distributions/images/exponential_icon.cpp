@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "exponential_icon.h"
+
+// Compressed 665 pixels into 318 bytes (15.94% compression ratio)/
+const uint8_t compressedPixelData[318] = {0x2f, 0x56, 0xff, 0x01, 0x00, 0x31, 0x2f, 0xad, 0xfe, 0x46, 0x00, 0x31, 0x1f, 0x03, 0x46, 0x00, 0x32, 0x3f, 0xc0, 0xfd, 0x56, 0x46, 0x00, 0x32, 0x2f, 0x47, 0xfe, 0x46, 0x00, 0x31, 0x3f, 0xc0, 0xfd, 0x34, 0x46, 0x00, 0x32, 0x3f, 0xe2, 0xfd, 0xdc, 0x46, 0x00, 0x30, 0x0f, 0xd6, 0x00, 0x2f, 0x22, 0xc0, 0xfd, 0x02, 0x00, 0x2f, 0x8b, 0xfe, 0x46, 0x00, 0x31, 0x5f, 0xc0, 0xfd, 0x6a, 0xfe, 0xfe, 0x46, 0x00, 0x30, 0x5f, 0xc0, 0xfd, 0x26, 0xfe, 0xbb, 0x46, 0x00, 0x30, 0x5f, 0xc0, 0xfd, 0xe1, 0xfd, 0x34, 0x46, 0x00, 0x30, 0x02, 0x6a, 0x01, 0x1f, 0x99, 0x46, 0x00, 0x30, 0x00, 0x02, 0x00, 0x3f, 0x8a, 0xfe, 0x99, 0x46, 0x00, 0x30, 0x00, 0x02, 0x00, 0x5f, 0x48, 0xfe, 0x34, 0xff, 0xde, 0x46, 0x00, 0x2e, 0x00, 0x02, 0x00, 0x7f, 0xc1, 0xfd, 0x8b, 0xfe, 0x34, 0xff, 0xdd, 0x46, 0x00, 0x2c, 0x06, 0xbe, 0x01, 0x5f, 0xad, 0xfe, 0x34, 0xff, 0xbb, 0x46, 0x00, 0x2c, 0x06, 0x9c, 0x00, 0xfe, 0x02, 0x26, 0xfe, 0x8b, 0xfe, 0xcf, 0xfe, 0x13, 0xff, 0x56, 0xff, 0x78, 0xff, 0xbb, 0xff, 0xdd, 0xff, 0xde, 0x46, 0x00, 0x0f, 0x02, 0x00, 0x26, 0x2f, 0x4c, 0x00, 0x01, 0x00, 0x0e, 0x1f, 0x91, 0x23, 0x00, 0x0f, 0x2f, 0xe2, 0x03, 0x23, 0x00, 0x0e, 0x2f, 0xff, 0x4e, 0x23, 0x00, 0x0f, 0x1f, 0xc6, 0x23, 0x00, 0x0f, 0x2f, 0xff, 0x5a, 0x23, 0x00, 0x0f, 0x2f, 0xe9, 0x18, 0x23, 0x00, 0x0e, 0x3f, 0xff, 0xc0, 0x06, 0x23, 0x00, 0x0e, 0x2f, 0xff, 0xa7, 0xd6, 0x00, 0x0b, 0x02, 0x2c, 0x06, 0x1f, 0x09, 0x23, 0x00, 0x0e, 0x3f, 0xff, 0xcf, 0x25, 0x23, 0x00, 0x0e, 0x4f, 0xff, 0xf1, 0x5b, 0x01, 0x23, 0x00, 0x0d, 0x4f, 0xff, 0xff, 0xc4, 0x31, 0x23, 0x00, 0x0e, 0x4f, 0xff, 0xfd, 0xab, 0x36, 0x23, 0x00, 0x0c, 0x00, 0x01, 0x00, 0x3f, 0xbf, 0x5f, 0x0c, 0x23, 0x00, 0x0d, 0x6f, 0xff, 0xff, 0xf5, 0xa7, 0x5b, 0x15, 0x23, 0x00, 0x0c, 0x00, 0x71, 0x00, 0x5f, 0xcd, 0x92, 0x59, 0x24, 0x02, 0x23, 0x00, 0x0a, 0x02, 0x4e, 0x00, 0x9e, 0xcb, 0xa5, 0x84, 0x64, 0x4f, 0x3b, 0x27, 0x13, 0x0c, 0x23, 0x00, 0x0a, 0x01, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 
+};
+
+constexpr Escher::Image image = Escher::Image(35, 19, compressedPixelData, 318, true);
+
+const Escher::Image * const ImageStore::ExponentialIcon = &image;
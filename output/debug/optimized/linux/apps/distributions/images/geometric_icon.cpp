@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "geometric_icon.h"
+
+// Compressed 665 pixels into 136 bytes (6.82% compression ratio)/
+const uint8_t compressedPixelData[136] = {0x1f, 0xff, 0x01, 0x00, 0x32, 0x2f, 0x80, 0xfd, 0x46, 0x00, 0xc1, 0x2f, 0x80, 0xfd, 0x46, 0x00, 0xc1, 0x2f, 0x80, 0xfd, 0x46, 0x00, 0x7b, 0x2f, 0x80, 0xfd, 0x46, 0x00, 0x7b, 0x2f, 0x80, 0xfd, 0x46, 0x00, 0x7b, 0x2f, 0x80, 0xfd, 0x46, 0x00, 0x35, 0x2f, 0x80, 0xfd, 0x46, 0x00, 0x35, 0x2f, 0x80, 0xfd, 0x46, 0x00, 0x35, 0x04, 0x04, 0x00, 0x2e, 0x6e, 0xfe, 0x56, 0x00, 0x0e, 0x46, 0x00, 0x0f, 0x04, 0x00, 0x2b, 0x0f, 0x46, 0x00, 0x33, 0x1f, 0x00, 0x01, 0x00, 0x0f, 0x1f, 0xff, 0x23, 0x00, 0x57, 0x1f, 0xff, 0x23, 0x00, 0x57, 0x1f, 0xff, 0x23, 0x00, 0x34, 0x1f, 0xff, 0x23, 0x00, 0x34, 0x1f, 0xff, 0x23, 0x00, 0x34, 0x1f, 0xff, 0x23, 0x00, 0x11, 0x1f, 0xff, 0x23, 0x00, 0x11, 0x1f, 0xff, 0x23, 0x00, 0x11, 0x0e, 0x2b, 0x00, 0x0e, 0x23, 0x00, 0x0e, 0x02, 0x00, 0x0f, 0x1f, 0x00, 0x0b, 0x50, 0xff, 0x00, 0xff, 0x00, 0xff, 
+};
+
+constexpr Escher::Image image = Escher::Image(35, 19, compressedPixelData, 136, true);
+
+const Escher::Image * const ImageStore::GeometricIcon = &image;
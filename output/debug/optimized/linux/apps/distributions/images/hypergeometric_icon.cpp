@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "hypergeometric_icon.h"
+
+// Compressed 665 pixels into 144 bytes (7.22% compression ratio)/
+const uint8_t compressedPixelData[144] = {0x1f, 0xff, 0x01, 0x00, 0x08, 0x3f, 0x80, 0xfd, 0xff, 0x01, 0x00, 0x30, 0x2e, 0x80, 0xfd, 0x4a, 0x00, 0x0f, 0x46, 0x00, 0xf9, 0x2f, 0x80, 0xfd, 0x42, 0x00, 0x31, 0x0f, 0x46, 0x00, 0xc3, 0x2f, 0x80, 0xfd, 0x42, 0x00, 0x31, 0x0f, 0x46, 0x00, 0x61, 0x2f, 0x80, 0xfd, 0x46, 0x00, 0x4d, 0x2f, 0x80, 0xfd, 0x46, 0x00, 0x7b, 0x2f, 0x80, 0xfd, 0x42, 0x00, 0x31, 0x2f, 0x80, 0xfd, 0x42, 0x00, 0x31, 0x0e, 0x4a, 0x00, 0x0f, 0x42, 0x00, 0x25, 0x0e, 0x4a, 0x00, 0x19, 0x00, 0x01, 0x00, 0x2f, 0xff, 0x00, 0x01, 0x00, 0x0e, 0x3f, 0xff, 0x00, 0xff, 0x23, 0x00, 0x7a, 0x1f, 0xff, 0x21, 0x00, 0x0f, 0x0f, 0x23, 0x00, 0x58, 0x1f, 0xff, 0x21, 0x00, 0x0f, 0x0f, 0x23, 0x00, 0x27, 0x1f, 0xff, 0x23, 0x00, 0x1d, 0x1f, 0xff, 0x23, 0x00, 0x34, 0x1f, 0xff, 0x21, 0x00, 0x0f, 0x1f, 0xff, 0x21, 0x00, 0x0f, 0x09, 0x25, 0x00, 0x1f, 0xff, 0x02, 0x00, 0x08, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+constexpr Escher::Image image = Escher::Image(35, 19, compressedPixelData, 144, true);
+
+const Escher::Image * const ImageStore::HypergeometricIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "exam_icon.h"
+
+// Compressed 162 pixels into 175 bytes (54.01% compression ratio)/
+const uint8_t compressedPixelData[175] = {0x28, 0xa6, 0xfd, 0x02, 0x00, 0xdd, 0xe8, 0xfd, 0xb1, 0xfe, 0x9a, 0xff, 0x9b, 0xff, 0xb1, 0xfe, 0xe8, 0xfd, 0xa6, 0x02, 0x00, 0x68, 0xc7, 0xfd, 0x6e, 0xfe, 0x58, 0xff, 0x01, 0x00, 0x55, 0x58, 0xff, 0x6e, 0xfe, 0xc7, 0x20, 0x00, 0x6f, 0x2b, 0xfe, 0xf4, 0xfe, 0xdd, 0xff, 0x01, 0x00, 0x01, 0x60, 0xdd, 0xff, 0xf4, 0xfe, 0x2b, 0xfe, 0x42, 0x00, 0x0f, 0x24, 0x00, 0x0f, 0x6f, 0xb1, 0xfe, 0xbc, 0xff, 0x6d, 0xfe, 0x6c, 0x00, 0x09, 0x31, 0xc6, 0xfd, 0xbc, 0x10, 0x00, 0x60, 0xa6, 0xfd, 0x79, 0xff, 0x2c, 0xfe, 0xb4, 0x00, 0x13, 0x9b, 0xb4, 0x00, 0x42, 0xc6, 0xfd, 0xd3, 0xfe, 0x8c, 0x00, 0x20, 0x6e, 0xfe, 0x34, 0x00, 0xf2, 0x09, 0x0a, 0xfe, 0xa6, 0xfd, 0x15, 0xff, 0xff, 0xff, 0x7a, 0xff, 0x90, 0xfe, 0x09, 0xfe, 0xc6, 0xfd, 0x0a, 0xfe, 0xb2, 0xfe, 0xbc, 0xff, 0x15, 0xff, 0x24, 0x00, 0x53, 0xe9, 0xfd, 0xe9, 0xfd, 0xf3, 0x30, 0x00, 0x28, 0xf4, 0xfe, 0x6c, 0x00, 0x2a, 0x15, 0xff, 0xf8, 0x00, 0x04, 0x0a, 0x00, 0xf0, 0x07, 0x4c, 0xfe, 0x58, 0xff, 0xde, 0xff, 0xde, 0xff, 0x79, 0xff, 0x4d, 0xfe, 0xa6, 0xfd, 0xa6, 0xfd, 0xa6, 0xfd, 0xa6, 0xfd, 0xa6, 0xfd, 
+};
+
+constexpr Escher::Image image = Escher::Image(18, 9, compressedPixelData, 175, false);
+
+const Escher::Image * const ImageStore::ExamIcon = &image;
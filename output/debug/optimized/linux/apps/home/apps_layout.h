@@ -0,0 +1,11 @@
+#ifndef HOME_APPS_LAYOUT_H
+#define HOME_APPS_LAYOUT_H
+// This file is auto-generated by apps_layout.py
+
+namespace Home {
+
+int PermutedAppSnapshotIndex(int index);
+
+}
+
+#endif
\ No newline at end of file
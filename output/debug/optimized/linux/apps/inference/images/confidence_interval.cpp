@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "confidence_interval.h"
+
+// Compressed 1215 pixels into 369 bytes (10.12% compression ratio)/
+const uint8_t compressedPixelData[369] = {0x24, 0xf3, 0x9c, 0x02, 0x00, 0x15, 0xff, 0x01, 0x00, 0x6c, 0xf3, 0x9c, 0x34, 0xa5, 0x14, 0xa5, 0x14, 0x00, 0x0e, 0x28, 0x00, 0x0f, 0x14, 0x00, 0x15, 0x0f, 0x01, 0x00, 0xff, 0x04, 0x7f, 0x58, 0xff, 0xe8, 0xfd, 0xe8, 0xfd, 0x58, 0x5a, 0x00, 0x40, 0x8f, 0xe8, 0xfd, 0xa6, 0xfd, 0xa6, 0xfd, 0xe8, 0xfd, 0x5a, 0x00, 0x45, 0x1f, 0xe9, 0x5a, 0x00, 0x14, 0x11, 0x37, 0xe2, 0x00, 0x1f, 0x57, 0x2c, 0x00, 0x12, 0x1e, 0x57, 0x0e, 0x01, 0x0f, 0xe2, 0x00, 0x68, 0x0f, 0x5a, 0x00, 0x41, 0x1f, 0x37, 0xf0, 0x01, 0x46, 0x0f, 0x01, 0x00, 0xbb, 0x24, 0xb2, 0x94, 0x02, 0x00, 0x4f, 0x92, 0x94, 0x71, 0x8c, 0x02, 0x00, 0x27, 0x3b, 0x92, 0x94, 0xb2, 0x02, 0x00, 0x0f, 0x7b, 0x01, 0xfe, 0x0f, 0xaa, 0x04, 0x74, 0x2f, 0xe9, 0xfd, 0x92, 0x00, 0x23, 0x1f, 0x57, 0x5a, 0x00, 0x2a, 0x02, 0x90, 0x03, 0x1b, 0x37, 0x16, 0x00, 0x2e, 0x09, 0xfe, 0x00, 0x04, 0x0f, 0xd6, 0x04, 0x1d, 0x1e, 0xe9, 0x44, 0x04, 0x0e, 0x16, 0x00, 0x0f, 0x9e, 0x04, 0x38, 0x0f, 0xa0, 0x01, 0x31, 0x0e, 0x52, 0x01, 0x0f, 0x01, 0x00, 0xf7, 0x0f, 0xd4, 0x08, 0x01, 0x24, 0x34, 0xa5, 0x02, 0x00, 0x0f, 0x28, 0x00, 0x29, 0x10, 0xdd, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x33, 0xda, 0xcc, 0xd5, 0x0a, 0x00, 0x06, 0x14, 0x00, 0x0e, 0x0a, 0x00, 0x0f, 0x01, 0x00, 0x7a, 0x4f, 0x4e, 0xe9, 0xea, 0x4e, 0x2d, 0x00, 0x16, 0x4f, 0xe7, 0xff, 0xff, 0xe6, 0x2d, 0x00, 0x16, 0x5e, 0xe8, 0xff, 0xff, 0xe0, 0x00, 0x01, 0x00, 0x4e, 0x53, 0xea, 0xeb, 0x51, 0x16, 0x00, 0x5e, 0x50, 0xeb, 0xea, 0x4f, 0x00, 0x01, 0x00, 0x4f, 0xed, 0xff, 0xff, 0xe8, 0x71, 0x00, 0x16, 0x4f, 0xea, 0xff, 0xff, 0xe9, 0x2d, 0x00, 0x16, 0x4f, 0x53, 0xeb, 0xe8, 0x4f, 0x8c, 0x01, 0x7d, 0x10, 0xee, 0x01, 0x00, 0x1f, 0xf4, 0xc7, 0x02, 0x0b, 0x23, 0xf4, 0xee, 0x01, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x88, 0x4f, 0x4e, 0xe7, 0xe7, 0x4c, 0x55, 0x02, 0x19, 0x1f, 0xe5, 0x9e, 0x02, 0x07, 0x0b, 0x2d, 0x02, 0x0d, 0x55, 0x02, 0x43, 0x52, 0xeb, 0xed, 0x54, 0x0b, 0x00, 0x1c, 0xdf, 0x2d, 0x02, 0x2b, 0x52, 0xec, 0x3e, 0x00, 0x43, 0xe3, 0xff, 0xff, 0xec, 0x0b, 0x00, 0x4f, 0xe5, 0xff, 0xff, 0xe7, 0xc0, 0x02, 0x0e, 0x13, 0xeb, 0x0b, 0x00, 0x3f, 0x4d, 0xea, 0xe9, 0x2d, 0x02, 0x0c, 0x4f, 0x4f, 0xe8, 0xe8, 0x51, 0x80, 0x01, 0x77, 0x06, 0x6a, 0x04, 0x10, 0xcc, 0x01, 0x00, 0x0f, 0x14, 0x00, 0x06, 0x50, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 
+};
+
+constexpr Escher::Image image = Escher::Image(45, 27, compressedPixelData, 369, true);
+
+const Escher::Image * const ImageStore::ConfidenceInterval = &image;
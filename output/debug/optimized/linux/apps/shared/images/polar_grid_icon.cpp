@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "polar_grid_icon.h"
+
+// Compressed 441 pixels into 728 bytes (55.03% compression ratio)/
+const uint8_t compressedPixelData[728] = {0x2e, 0xff, 0xff, 0x01, 0x00, 0x3f, 0x34, 0xa5, 0xff, 0x01, 0x00, 0x0c, 0xff, 0x03, 0x9e, 0xf7, 0x9a, 0xd6, 0xd7, 0xbd, 0x75, 0xad, 0x34, 0xa5, 0x55, 0xad, 0xd6, 0xb5, 0x9a, 0xd6, 0x9e, 0xf7, 0x26, 0x00, 0x01, 0xf2, 0x03, 0xdf, 0xff, 0x59, 0xce, 0x55, 0xad, 0x59, 0xce, 0x3c, 0xe7, 0xbe, 0xf7, 0x34, 0xa5, 0xbe, 0xf7, 0x3c, 0xe7, 0x10, 0x00, 0x1b, 0xdf, 0x28, 0x00, 0x8a, 0xf7, 0xbd, 0x96, 0xb5, 0x38, 0xc6, 0xbe, 0xf7, 0x7e, 0x00, 0x88, 0xbe, 0xf7, 0x18, 0xc6, 0x96, 0xb5, 0xf7, 0xbd, 0x50, 0x00, 0x6e, 0x96, 0xb5, 0x54, 0xa5, 0x3c, 0xe7, 0xa8, 0x00, 0x66, 0x3c, 0xe7, 0x54, 0xa5, 0x96, 0xb5, 0x2a, 0x00, 0x80, 0x79, 0xce, 0x38, 0xc6, 0x5c, 0xe7, 0x75, 0xad, 0x7a, 0x00, 0xa0, 0x59, 0xce, 0x95, 0xad, 0x34, 0xa5, 0x96, 0xb5, 0x59, 0xce, 0x82, 0x00, 0x00, 0x14, 0x00, 0x44, 0x17, 0xbe, 0x79, 0xce, 0xc8, 0x00, 0x20, 0x55, 0xad, 0x78, 0x00, 0x60, 0x5c, 0xe7, 0x55, 0xad, 0x55, 0xad, 0xc8, 0x00, 0x60, 0x34, 0xa5, 0x9e, 0xf7, 0x79, 0xce, 0x0e, 0x00, 0x00, 0x68, 0x00, 0x13, 0xbe, 0x20, 0x00, 0x64, 0xff, 0xff, 0x9a, 0xd6, 0x59, 0xce, 0x32, 0x00, 0x02, 0x1c, 0x00, 0x00, 0x7e, 0x00, 0x11, 0x3c, 0x38, 0x00, 0x02, 0xfe, 0x00, 0x40, 0x58, 0xc6, 0xba, 0xd6, 0x08, 0x00, 0x22, 0xd6, 0xb5, 0xa2, 0x00, 0x42, 0x38, 0xc6, 0x9a, 0xd6, 0x84, 0x00, 0x22, 0x34, 0xa5, 0x78, 0x00, 0x42, 0x99, 0xce, 0x59, 0xce, 0xae, 0x00, 0x11, 0xd7, 0xd6, 0x00, 0x22, 0x54, 0xa5, 0x5c, 0x00, 0x31, 0x75, 0xad, 0x9e, 0x84, 0x00, 0x00, 0x50, 0x01, 0x00, 0x28, 0x00, 0x00, 0x66, 0x00, 0x22, 0x95, 0xad, 0x6e, 0x00, 0x20, 0x75, 0xad, 0x6a, 0x00, 0x0f, 0x02, 0x00, 0x15, 0x24, 0xff, 0xff, 0xb0, 0x00, 0x11, 0x75, 0x08, 0x00, 0x19, 0x3c, 0x54, 0x00, 0x00, 0x4c, 0x00, 0x06, 0x08, 0x00, 0x17, 0xb6, 0xa8, 0x00, 0x13, 0x3c, 0xa8, 0x00, 0x02, 0xb0, 0x00, 0x2a, 0x9a, 0xd6, 0xa8, 0x00, 0x0f, 0xfc, 0x00, 0x03, 0x17, 0x5c, 0xfc, 0x00, 0x00, 0x44, 0x00, 0x08, 0x50, 0x01, 0x02, 0x18, 0x01, 0x13, 0xba, 0x50, 0x01, 0x2e, 0x9a, 0xd6, 0x50, 0x01, 0x62, 0xff, 0xff, 0x59, 0xce, 0x18, 0xc6, 0x78, 0x00, 0x42, 0x9e, 0xf7, 0x38, 0xc6, 0xa8, 0x00, 0x42, 0x59, 0xce, 0x9e, 0xf7, 0x84, 0x00, 0x4f, 0xf7, 0xbd, 0x79, 0xce, 0xf8, 0x01, 0x1f, 0x02, 0x4c, 0x02, 0x1f, 0x18, 0x4c, 0x02, 0x10, 0x04, 0x84, 0x00, 0x06, 0xa0, 0x02, 0x13, 0x9e, 0xa0, 0x02, 0x06, 0x78, 0x00, 0x0c, 0xf4, 0x02, 0x13, 0xba, 0xf4, 0x02, 0x7e, 0x75, 0xad, 0xd7, 0xbd, 0x9a, 0xd6, 0xbe, 0xf4, 0x02, 0x0f, 0x48, 0x03, 0x12, 0x15, 0x00, 0x01, 0x00, 0x2b, 0xff, 0x00, 0x01, 0x00, 0x96, 0x23, 0x7a, 0xc5, 0xe7, 0xff, 0xf1, 0xc8, 0x81, 0x20, 0x13, 0x00, 0xd3, 0x09, 0x93, 0xef, 0x97, 0x47, 0x1b, 0xff, 0x1c, 0x49, 0x98, 0xf2, 0x91, 0x0a, 0x14, 0x00, 0x43, 0xb6, 0xd8, 0xa7, 0x19, 0x3f, 0x00, 0x41, 0x1a, 0xb0, 0xdb, 0xb4, 0x14, 0x00, 0x45, 0x0a, 0xd7, 0xf5, 0x43, 0x54, 0x00, 0x40, 0x44, 0xf6, 0xd6, 0x06, 0x08, 0x00, 0xf0, 0x1c, 0x8f, 0xa6, 0x41, 0xeb, 0x43, 0x1e, 0x96, 0xde, 0xff, 0xdd, 0x92, 0x1e, 0x43, 0xeb, 0x44, 0xb1, 0x89, 0x00, 0x00, 0x00, 0x20, 0xee, 0x19, 0x00, 0x41, 0xf1, 0xf0, 0x80, 0x26, 0xff, 0x26, 0x86, 0xef, 0xf0, 0x43, 0x00, 0x1d, 0xee, 0x1c, 0x00, 0x00, 0x7c, 0x91, 0x19, 0x00, 0xff, 0x2a, 0xf0, 0x43, 0x00, 0xff, 0x00, 0x43, 0xf0, 0xf0, 0x20, 0x00, 0x00, 0x9b, 0x76, 0x00, 0x00, 0xc8, 0x42, 0x00, 0x00, 0x9c, 0x7d, 0x41, 0xeb, 0x43, 0xff, 0x43, 0xeb, 0x43, 0x84, 0x95, 0x00, 0x00, 0x4b, 0xc2, 0x00, 0x00, 0xf4, 0x1b, 0x00, 0x00, 0xe5, 0x21, 0x00, 0x41, 0xeb, 0xff, 0xeb, 0x43, 0x00, 0x28, 0xdf, 0x00, 0x00, 0x22, 0xeb, 0x00, 0xff, 0xe7, 0x00, 0x02, 0x81, 0xf2, 0x1b, 0x00, 0x00, 0xe4, 0x1f, 0x00, 0x43, 0x2a, 0x00, 0x90, 0x26, 0xe0, 0x00, 0x00, 0x22, 0xe3, 0x00, 0x00, 0xca, 0x54, 0x00, 0xa2, 0x7a, 0x43, 0xeb, 0x42, 0xff, 0x41, 0xeb, 0x43, 0x81, 0x98, 0x54, 0x00, 0xf1, 0x2d, 0x83, 0x91, 0x00, 0x00, 0x24, 0xf0, 0xef, 0x42, 0x00, 0xff, 0x00, 0x41, 0xf0, 0xed, 0x22, 0x00, 0x00, 0x9c, 0x7f, 0x00, 0x00, 0x22, 0xf1, 0x19, 0x00, 0x42, 0xf1, 0xef, 0x78, 0x20, 0xff, 0x21, 0x7d, 0xef, 0xf1, 0x43, 0x00, 0x18, 0xef, 0x1e, 0x00, 0x00, 0x00, 0x92, 0xa9, 0x42, 0xeb, 0x42, 0x24, 0x9e, 0xe5, 0xff, 0xe4, 0x9a, 0x21, 0x41, 0xeb, 0x44, 0xb3, 0x8d, 0xfc, 0x00, 0x35, 0xd6, 0xf5, 0x42, 0xfc, 0x00, 0x41, 0x42, 0xf6, 0xd5, 0x06, 0x12, 0x01, 0x43, 0xb5, 0xd6, 0xab, 0x15, 0x15, 0x00, 0x43, 0x18, 0xac, 0xda, 0xb4, 0x3c, 0x01, 0xd6, 0x08, 0x92, 0xef, 0x99, 0x4a, 0x1f, 0xff, 0x20, 0x4c, 0x9a, 0xef, 0x8e, 0x08, 0x67, 0x01, 0x9b, 0x20, 0x78, 0xc3, 0xe5, 0xff, 0xe5, 0xc4, 0x80, 0x1f, 0x93, 0x01, 0x03, 0xa4, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+constexpr Escher::Image image = Escher::Image(21, 21, compressedPixelData, 728, true);
+
+const Escher::Image * const ImageStore::PolarGridIcon = &image;
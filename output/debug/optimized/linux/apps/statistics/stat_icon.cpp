@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "stat_icon.h"
+
+// Compressed 3080 pixels into 804 bytes (13.05% compression ratio)/
+const uint8_t compressedPixelData[804] = {0x15, 0xff, 0x01, 0x00, 0xcf, 0xdf, 0xff, 0x7a, 0xce, 0xf4, 0x9c, 0x11, 0x7c, 0x6f, 0x6b, 0x4e, 0x63, 0x02, 0x00, 0x31, 0xae, 0x6f, 0x6b, 0xf0, 0x7b, 0xf4, 0x9c, 0x7a, 0xce, 0xdf, 0xff, 0x01, 0x00, 0x6f, 0x7a, 0xce, 0xf1, 0x7b, 0x4e, 0x63, 0x02, 0x00, 0x41, 0x4a, 0xf1, 0x7b, 0x9a, 0xd6, 0x6c, 0x00, 0x4f, 0x76, 0xad, 0x4e, 0x63, 0x02, 0x00, 0x49, 0x26, 0x76, 0xad, 0x6c, 0x00, 0x4f, 0x35, 0xa5, 0x4e, 0x63, 0x02, 0x00, 0x4d, 0x24, 0x96, 0xad, 0x44, 0x01, 0x2f, 0x4e, 0x63, 0x02, 0x00, 0x51, 0x20, 0x9a, 0xce, 0x1c, 0x02, 0x2f, 0xd0, 0x73, 0x6e, 0x00, 0x53, 0x8f, 0xd0, 0x73, 0xdf, 0xff, 0x59, 0xc6, 0x4e, 0x63, 0x02, 0x00, 0x55, 0x4f, 0x59, 0xce, 0xd4, 0x94, 0x6e, 0x00, 0x57, 0x4f, 0xf4, 0x9c, 0xd0, 0x73, 0x6e, 0x00, 0x57, 0x1e, 0xf0, 0x64, 0x03, 0x0f, 0x02, 0x00, 0x48, 0x0f, 0x38, 0x04, 0x35, 0x0f, 0x02, 0x00, 0xff, 0xf6, 0x6c, 0x6e, 0x6b, 0xf8, 0xbd, 0xbe, 0xf7, 0x3a, 0x06, 0x5f, 0xbe, 0xf7, 0xf8, 0xbd, 0x6e, 0x6a, 0x02, 0x40, 0x3f, 0xf8, 0xbd, 0xff, 0x01, 0x00, 0x04, 0x2f, 0xd7, 0xb5, 0x6c, 0x00, 0x3d, 0x2e, 0x2e, 0x63, 0x14, 0x07, 0x06, 0x86, 0x07, 0x1f, 0x2e, 0x6c, 0x00, 0x3c, 0x3f, 0x0d, 0x5b, 0xff, 0x01, 0x00, 0x06, 0x5f, 0x5d, 0xef, 0x0d, 0x5b, 0x2e, 0x6e, 0x00, 0x54, 0x4f, 0x5d, 0xef, 0x1c, 0xe7, 0x6e, 0x00, 0x3d, 0x2f, 0xed, 0x5a, 0x6c, 0x00, 0x03, 0x8f, 0x3d, 0xef, 0x1c, 0xe7, 0x1c, 0xe7, 0xed, 0x5a, 0x6e, 0x00, 0x4f, 0x13, 0xdf, 0x6c, 0x00, 0x02, 0x6e, 0x00, 0x0f, 0xb4, 0x02, 0x37, 0x0f, 0x6e, 0x00, 0x01, 0x31, 0xbf, 0xf7, 0x1d, 0x6a, 0x00, 0x04, 0x6e, 0x00, 0x0f, 0xb4, 0x02, 0x37, 0x0e, 0x6e, 0x00, 0x24, 0x9e, 0xf7, 0x6a, 0x00, 0x02, 0x6e, 0x00, 0x2f, 0x0d, 0x5b, 0xb4, 0x02, 0x37, 0x0c, 0x6e, 0x00, 0x19, 0x7e, 0x6c, 0x00, 0x02, 0x6e, 0x00, 0x2f, 0x9e, 0xf7, 0xb6, 0x02, 0x07, 0x0f, 0x46, 0x02, 0x1b, 0x0a, 0x6e, 0x00, 0x00, 0x86, 0x02, 0x0b, 0x6e, 0x00, 0x6f, 0x52, 0xed, 0x5a, 0x1d, 0xe7, 0xdf, 0x6e, 0x00, 0x40, 0x04, 0x1a, 0x02, 0x0c, 0x6e, 0x00, 0x4f, 0x1c, 0xe7, 0x3d, 0xef, 0x6e, 0x00, 0x05, 0x2f, 0xed, 0x5a, 0x6e, 0x00, 0x21, 0x06, 0x86, 0x02, 0x0e, 0x6e, 0x00, 0x00, 0x08, 0x00, 0x2f, 0x5d, 0xef, 0x6e, 0x00, 0x17, 0x6a, 0xd7, 0xb5, 0x5d, 0xef, 0xbe, 0xf7, 0x02, 0x00, 0x44, 0x5d, 0xef, 0xd7, 0xb5, 0x6e, 0x00, 0x08, 0x86, 0x02, 0x0e, 0x6e, 0x00, 0x02, 0x0a, 0x00, 0x2f, 0x9e, 0xf7, 0x6e, 0x00, 0x13, 0x2c, 0xd7, 0xb5, 0x6a, 0x00, 0x04, 0x02, 0x00, 0x20, 0xb7, 0xb5, 0x6e, 0x00, 0x0a, 0x86, 0x02, 0x0e, 0x6e, 0x00, 0x04, 0x0c, 0x00, 0x1f, 0xbf, 0x6e, 0x00, 0x10, 0x4f, 0x2e, 0x63, 0x9e, 0xf7, 0x6e, 0x00, 0x05, 0x46, 0x7e, 0xef, 0x0d, 0x5b, 0x4e, 0x00, 0x0f, 0x6e, 0x00, 0x0d, 0x1e, 0x3d, 0x2e, 0x02, 0x0b, 0x6e, 0x00, 0x00, 0x08, 0x05, 0x1f, 0xbe, 0x6e, 0x00, 0x06, 0x2f, 0x1c, 0xe7, 0x6e, 0x00, 0x19, 0x0e, 0xbe, 0x01, 0x0f, 0x6e, 0x00, 0x17, 0x40, 0x9e, 0xf7, 0x3d, 0xef, 0x50, 0x03, 0x0f, 0x6e, 0x00, 0x19, 0x4e, 0x1c, 0xe7, 0x7e, 0xef, 0x6e, 0x00, 0x0a, 0x74, 0x02, 0x0f, 0x6c, 0x00, 0x04, 0x03, 0xbe, 0x03, 0x0f, 0x6e, 0x00, 0x1b, 0x4f, 0x1c, 0xe7, 0xbe, 0xf7, 0x6e, 0x00, 0x1d, 0x2e, 0x7d, 0xef, 0x4e, 0x00, 0x0f, 0x6e, 0x00, 0x15, 0x0a, 0xec, 0x03, 0x0f, 0x6e, 0x00, 0x0f, 0x08, 0x32, 0x04, 0x0f, 0x6e, 0x00, 0x1f, 0x0a, 0xec, 0x03, 0x0e, 0x6e, 0x00, 0x0e, 0xae, 0x01, 0x0f, 0x6e, 0x00, 0x2b, 0x08, 0x2e, 0x02, 0x0f, 0x6e, 0x00, 0x09, 0x1d, 0x7e, 0xc6, 0x03, 0x0f, 0x6e, 0x00, 0x23, 0x06, 0xec, 0x03, 0x0e, 0x6e, 0x00, 0x0e, 0x42, 0x01, 0x0f, 0x6e, 0x00, 0x2f, 0x04, 0xec, 0x03, 0x0e, 0x6e, 0x00, 0x0e, 0x42, 0x01, 0x0f, 0x6e, 0x00, 0x31, 0x02, 0xec, 0x03, 0x0e, 0x6e, 0x00, 0x06, 0xf0, 0x02, 0x0f, 0x6e, 0x00, 0x39, 0x02, 0xbe, 0x01, 0x0e, 0x6e, 0x00, 0x1e, 0x7e, 0xd6, 0x00, 0x0f, 0x6e, 0x00, 0x32, 0x00, 0xec, 0x03, 0x0e, 0x4c, 0x04, 0x0f, 0x4e, 0x00, 0x0a, 0x0e, 0xde, 0x03, 0x0f, 0x20, 0x00, 0x1a, 0x2c, 0x0d, 0x5b, 0x6e, 0x00, 0x3f, 0xcc, 0x52, 0xac, 0x02, 0x00, 0x04, 0x4f, 0xcc, 0x52, 0x0d, 0x5b, 0x20, 0x00, 0x2d, 0x1d, 0x2e, 0xa0, 0x0a, 0x00, 0x7c, 0x05, 0x0e, 0x02, 0x00, 0x00, 0x18, 0x00, 0x1f, 0x2e, 0x20, 0x00, 0x2e, 0x0e, 0xa0, 0x07, 0x0f, 0x02, 0x00, 0x07, 0x0f, 0x20, 0x00, 0x31, 0x04, 0x24, 0x00, 0x0f, 0x96, 0x0d, 0x57, 0x3f, 0x2d, 0x63, 0x0d, 0x6e, 0x00, 0x5a, 0x1f, 0xaf, 0x30, 0x11, 0x58, 0x4f, 0xcf, 0x73, 0xb7, 0xb5, 0x4c, 0x01, 0x55, 0x8f, 0x2e, 0x63, 0xd7, 0xbd, 0xdf, 0xff, 0xcc, 0x5a, 0x6e, 0x00, 0x53, 0x20, 0xec, 0x5a, 0xc6, 0x04, 0x4f, 0xf7, 0xbd, 0xcc, 0x52, 0x6c, 0x00, 0x4f, 0x42, 0xac, 0x52, 0x18, 0xc6, 0x12, 0x06, 0x4f, 0x93, 0x94, 0xcc, 0x52, 0x6c, 0x00, 0x4d, 0x26, 0xb3, 0x94, 0x5e, 0x07, 0x5f, 0x72, 0x8c, 0x6a, 0x4a, 0x2d, 0x6a, 0x00, 0x44, 0x6a, 0x0d, 0x63, 0x6a, 0x4a, 0x72, 0x8c, 0x18, 0x09, 0x9f, 0xf8, 0xbd, 0xcb, 0x5a, 0x6a, 0x4a, 0xec, 0x5a, 0x2d, 0xf2, 0x02, 0x3a, 0x6e, 0xec, 0x5a, 0x6a, 0x4a, 0xcc, 0x5a, 0xdc, 0x0d, 0x00, 0xe6, 0x0b, 0xaf, 0xb7, 0xb5, 0xf0, 0x7b, 0xcc, 0x5a, 0x49, 0x4a, 0x08, 0x42, 0x02, 0x00, 0x31, 0x83, 0x09, 0x42, 0xab, 0x52, 0x10, 0x84, 0xf8, 0xbd, 0x10, 0x09, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 
+};
+
+constexpr Escher::Image image = Escher::Image(55, 56, compressedPixelData, 804, false);
+
+const Escher::Image * const ImageStore::StatIcon = &image;
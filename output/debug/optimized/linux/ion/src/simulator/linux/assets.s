@@ -0,0 +1,48 @@
+.global _ion_simulator_horizontal_arrow_start
+.global _ion_simulator_horizontal_arrow_end
+_ion_simulator_horizontal_arrow_start:
+    .incbin "ion/src/simulator/assets/horizontal_arrow.png"
+_ion_simulator_horizontal_arrow_end:
+
+.global _ion_simulator_large_squircle_start
+.global _ion_simulator_large_squircle_end
+_ion_simulator_large_squircle_start:
+    .incbin "ion/src/simulator/assets/large_squircle.png"
+_ion_simulator_large_squircle_end:
+
+.global _ion_simulator_round_start
+.global _ion_simulator_round_end
+_ion_simulator_round_start:
+    .incbin "ion/src/simulator/assets/round.png"
+_ion_simulator_round_end:
+
+.global _ion_simulator_small_squircle_start
+.global _ion_simulator_small_squircle_end
+_ion_simulator_small_squircle_start:
+    .incbin "ion/src/simulator/assets/small_squircle.png"
+_ion_simulator_small_squircle_end:
+
+.global _ion_simulator_vertical_arrow_start
+.global _ion_simulator_vertical_arrow_end
+_ion_simulator_vertical_arrow_start:
+    .incbin "ion/src/simulator/assets/vertical_arrow.png"
+_ion_simulator_vertical_arrow_end:
+
+.global _ion_simulator_background_with_shadow_start
+.global _ion_simulator_background_with_shadow_end
+_ion_simulator_background_with_shadow_start:
+    .incbin "ion/src/simulator/assets/epsilon/background-with-shadow.webp"
+_ion_simulator_background_with_shadow_end:
+
+.global _ion_simulator_background_start
+.global _ion_simulator_background_end
+_ion_simulator_background_start:
+    .incbin "output/debug/optimized/linux/app/assets/background.jpg"
+_ion_simulator_background_end:
+
+.global _ion_simulator_background_no_shadow_start
+.global _ion_simulator_background_no_shadow_end
+_ion_simulator_background_no_shadow_start:
+    .incbin "output/debug/optimized/linux/app/assets/background-no-shadow.webp"
+_ion_simulator_background_no_shadow_end:
+
@@ -0,0 +1,482 @@
+/* This file is auto-generated by the rasterizer */
+
+#include "../SmallFont.h"
+#include <kandinsky/font.h>
+
+constexpr static KDCoordinate numberOfCodePoints = 154;
+constexpr static uint16_t glyphDataOffset[numberOfCodePoints + 1] = {
+  0x0000, 0x000b, 0x0025, 0x003b, 0x005f, 0x008f, 0x00ba, 0x00e5, 0x00fb,
+  0x012d, 0x0160, 0x0182, 0x019d, 0x01b4, 0x01c6, 0x01d5, 0x0207, 0x0232,
+  0x024e, 0x0279, 0x02a4, 0x02cd, 0x02f5, 0x0320, 0x034a, 0x0375, 0x03a0,
+  0x03b3, 0x03ce, 0x03f9, 0x040c, 0x0438, 0x0461, 0x0491, 0x04bb, 0x04e6,
+  0x0510, 0x053b, 0x055d, 0x057f, 0x05aa, 0x05cb, 0x05e9, 0x060b, 0x0635,
+  0x064f, 0x067a, 0x06a5, 0x06d0, 0x06f9, 0x0729, 0x0754, 0x077f, 0x079a,
+  0x07b9, 0x07e3, 0x080e, 0x0839, 0x0862, 0x088d, 0x08a8, 0x08d8, 0x08f3,
+  0x0913, 0x0924, 0x093c, 0x095f, 0x0989, 0x09ab, 0x09d6, 0x09f9, 0x0a1b,
+  0x0a44, 0x0a69, 0x0a86, 0x0aa5, 0x0ace, 0x0aec, 0x0b0a, 0x0b28, 0x0b4b,
+  0x0b74, 0x0b9d, 0x0bbd, 0x0be0, 0x0c03, 0x0c21, 0x0c43, 0x0c66, 0x0c89,
+  0x0cb2, 0x0cd5, 0x0cf8, 0x0d0a, 0x0d2c, 0x0d41, 0x0d5e, 0x0d76, 0x0d95,
+  0x0da5, 0x0dc2, 0x0dec, 0x0e17, 0x0e3d, 0x0e68, 0x0e90, 0x0ebe, 0x0ee1,
+  0x0f0f, 0x0f25, 0x0f48, 0x0f73, 0x0f8b, 0x0fa3, 0x0fbb, 0x0fd0, 0x0fe2,
+  0x0ff3, 0x1007, 0x101a, 0x103d, 0x1056, 0x1080, 0x10ab, 0x10d5, 0x10f8,
+  0x112b, 0x1154, 0x1182, 0x11a5, 0x11d7, 0x11fb, 0x1229, 0x1257, 0x127b,
+  0x1297, 0x12c0, 0x12e3, 0x130c, 0x132f, 0x134d, 0x1371, 0x1390, 0x13af,
+  0x13df, 0x1412, 0x142f, 0x1452, 0x146f, 0x1496, 0x14bf, 0x14ea, 0x1517,
+  0x1549, 0x1574
+};
+
+/* Rasterized  = 15092 bytes (154 glyphs x 98 pixels)
+ * Downsampled =  7546 bytes (1/2 of rasterized)
+ * Compressed  =  5492 bytes (36.39% of rasterized) */
+constexpr static uint8_t glyphData[5492] = {
+  0x1f, 0x00, 0x01, 0x00, 0x18, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x01, 0x00, 0x5c, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x00, 0x16, 0x00, 0x07,
+  0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x01, 0x00, 0x51, 0xf0, 0xf0, 0x00, 0x0f, 0x0f, 0x07, 0x00, 0x0f, 0x01, 0x00,
+  0x07, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xd0, 0xf0,
+  0x0f, 0x00, 0x0f, 0x00, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0x00, 0xf0, 0x0e,
+  0x00, 0x33, 0xff, 0xff, 0xff, 0x15, 0x00, 0x14, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xf1, 0x11, 0xf0, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x5e, 0xfe, 0x70, 0x0e, 0x20, 0x3b, 0x10, 0xd7, 0x00, 0x00,
+  0x01, 0xae, 0xa2, 0x00, 0x00, 0x17, 0xe0, 0x0d, 0x50, 0x3f, 0x00, 0x3d, 0xfe,
+  0x60, 0x00, 0x0f, 0x25, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x8f, 0x90, 0x0a, 0xaf, 0x3f, 0x06, 0xe0,
+  0x8f, 0x72, 0xf3, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x3f, 0x29,
+  0xf8, 0x0e, 0x60, 0xf3, 0xfa, 0xb0, 0x08, 0xf9, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x05, 0xee, 0x60,
+  0x00, 0xe2, 0x3e, 0x00, 0x0e, 0x14, 0xe0, 0x00, 0x9d, 0xe3, 0x00, 0x5f, 0xf7,
+  0x04, 0xce, 0x26, 0xf5, 0xe3, 0xe3, 0x06, 0xfa, 0x03, 0xcf, 0xfa, 0xcf, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0x52,
+  0x0f, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x00, 0x0f, 0x01, 0x00, 0x06, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xf0, 0x1d, 0x01, 0xa0, 0x00,
+  0x00, 0xbb, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x0b, 0x50, 0x00, 0x00, 0xe1, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x6a,
+  0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x02, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xf0, 0x22, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x0a, 0xb0,
+  0x00, 0x00, 0x0c, 0x40, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x0a, 0x70, 0x00,
+  0x08, 0xe0, 0x00, 0x01, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x00, 0x01, 0x00, 0xf8, 0x05, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0xf8, 0xf8, 0xf0, 0x02, 0xaf, 0xa2, 0x00, 0x6f, 0x8f, 0x60, 0x0f, 0x70, 0x6f,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00,
+  0x90, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0x07, 0x00, 0x2a,
+  0x00, 0x0f, 0x1d, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01,
+  0x00, 0x0d, 0xf0, 0x01, 0xfc, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x01, 0xb6, 0x00,
+  0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x01, 0x3f,
+  0x0f, 0xff, 0xff, 0x17, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0x00, 0x0d, 0x16, 0xf0, 0x0b, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x01, 0x00, 0xf0, 0x1d, 0x03, 0xf1, 0x00, 0x00, 0x9b, 0x00,
+  0x00, 0x0e, 0x60, 0x00, 0x04, 0xf0, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x0f, 0x40,
+  0x00, 0x05, 0xe0, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x1f, 0x30, 0x00, 0x07, 0xd0,
+  0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x00, 0x01, 0x00, 0xf4, 0x0e, 0x03, 0xdf, 0xd3, 0x00, 0xb8, 0x05, 0xc0, 0x0e,
+  0x10, 0x0f, 0x00, 0xf0, 0xd0, 0xf0, 0x0f, 0x0d, 0x0f, 0x00, 0xe1, 0x01, 0xf0,
+  0x0b, 0x70, 0x7c, 0x00, 0x2d, 0xfd, 0x40, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0x8c, 0xff, 0x00, 0x00, 0x00, 0xf0,
+  0x00, 0x00, 0x0f, 0x07, 0x00, 0x44, 0xff, 0xff, 0xf0, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x04, 0xdf,
+  0xc3, 0x00, 0xa3, 0x05, 0xd0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x06, 0xb0, 0x00,
+  0x04, 0xe2, 0x00, 0x05, 0xe3, 0x00, 0x07, 0xe2, 0x00, 0x00, 0xff, 0xff, 0xf0,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00,
+  0xf4, 0x0e, 0x05, 0xdf, 0xe8, 0x01, 0xe5, 0x04, 0xf0, 0x00, 0x00, 0x3f, 0x00,
+  0x0f, 0xff, 0x80, 0x00, 0x02, 0x9e, 0x00, 0x00, 0x00, 0xf0, 0x1c, 0x30, 0x4e,
+  0x00, 0x6d, 0xfd, 0x40, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x01, 0x00, 0xf5, 0x0c, 0x04, 0xf0, 0x00, 0x00, 0xdf, 0x00, 0x00,
+  0x8a, 0xf0, 0x00, 0x2e, 0x1f, 0x00, 0x0b, 0x50, 0xf0, 0x00, 0xff, 0xff, 0xf0,
+  0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf0, 0x04, 0x0f, 0xff, 0xff, 0x00, 0xf0,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x70, 0x00, 0x00, 0x5f, 0x00,
+  0x00, 0x10, 0x00, 0x12, 0x5f, 0x0e, 0x00, 0x03, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x02, 0xbf, 0xff, 0x00,
+  0xab, 0x10, 0x00, 0x0e, 0x30, 0x00, 0x00, 0xff, 0xfe, 0x60, 0x0f, 0x00, 0x4e,
+  0x00, 0xf0, 0x00, 0xf0, 0x0e, 0x50, 0x2e, 0x00, 0x7e, 0xff, 0x70, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf5, 0x0d,
+  0x0f, 0xff, 0xff, 0x00, 0x00, 0x06, 0x90, 0x00, 0x01, 0xd0, 0x00, 0x00, 0x87,
+  0x00, 0x00, 0x0c, 0x20, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0xf0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01,
+  0x00, 0xf4, 0x0e, 0x08, 0xef, 0xe8, 0x00, 0xf1, 0x02, 0xf0, 0x0f, 0x00, 0x0f,
+  0x00, 0x9f, 0xff, 0xa0, 0x0e, 0x30, 0x2e, 0x00, 0xf0, 0x00, 0xf0, 0x0f, 0x10,
+  0x1f, 0x00, 0x8e, 0xff, 0x80, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x07, 0xff, 0xe7, 0x00, 0xe3, 0x05,
+  0xe0, 0x0f, 0x00, 0x0f, 0x00, 0xe4, 0x00, 0xf0, 0x06, 0xef, 0xff, 0x00, 0x00,
+  0x03, 0xe0, 0x00, 0x01, 0xba, 0x00, 0xff, 0xfb, 0x10, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x2c, 0x0f, 0x00, 0x01,
+  0x00, 0x16, 0xf0, 0x0b, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x01, 0x00, 0x2c, 0x0f, 0x00, 0x01, 0x00, 0xf0, 0x01, 0xfc, 0x00, 0x00, 0x01,
+  0xe0, 0x00, 0x01, 0xb6, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+  0x00, 0x01, 0x00, 0xf0, 0x04, 0x01, 0x00, 0x00, 0x05, 0xe0, 0x00, 0x1a, 0xe5,
+  0x00, 0x5e, 0xa1, 0x00, 0x0f, 0xa0, 0x00, 0x00, 0x5e, 0xb1, 0x00, 0x0e, 0x00,
+  0x00, 0x15, 0x00, 0x00, 0x1c, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x00, 0x01, 0x00, 0x37, 0xff, 0xff, 0xf0, 0x07, 0x00,
+  0x08, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00,
+  0xf0, 0x06, 0x01, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x05, 0xea, 0x10, 0x00,
+  0x01, 0xae, 0x50, 0x00, 0x00, 0xaf, 0x00, 0x01, 0xbe, 0x50, 0x0e, 0x00, 0x12,
+  0xe5, 0x1c, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf1, 0x09, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xfd, 0x30, 0x0c, 0x50, 0x6d,
+  0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x1d, 0x20, 0x00, 0x0a,
+  0x60, 0x0d, 0x00, 0x12, 0x00, 0x14, 0x00, 0x04, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf0, 0x1b, 0x01, 0x9e, 0xf9, 0x00,
+  0xc9, 0x11, 0xb8, 0x7a, 0x00, 0x02, 0xed, 0x30, 0x3b, 0xef, 0xf0, 0x0e, 0x61,
+  0xff, 0x00, 0xf2, 0x7f, 0xd3, 0x09, 0xf8, 0xf7, 0xb0, 0x00, 0x00, 0x0d, 0xa2,
+  0x07, 0xc0, 0x19, 0xef, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+  0x00, 0x01, 0x00, 0xf4, 0x0d, 0x3f, 0x20, 0x00, 0x09, 0xb8, 0x00, 0x00, 0xe1,
+  0xd0, 0x00, 0x5b, 0x09, 0x40, 0x0b, 0xff, 0xfa, 0x01, 0xe0, 0x00, 0xd0, 0x78,
+  0x00, 0x08, 0x5d, 0x20, 0x00, 0x3b, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x0f, 0xff, 0xd5, 0x00, 0xf0,
+  0x04, 0xe0, 0x0f, 0x00, 0x3f, 0x00, 0xff, 0xff, 0x80, 0x0f, 0x00, 0x4d, 0x00,
+  0xf0, 0x00, 0xf0, 0x0f, 0x00, 0x3e, 0x00, 0xff, 0xfd, 0x40, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf4, 0x0d, 0x6d,
+  0xfd, 0x50, 0x4c, 0x20, 0x44, 0x0b, 0x30, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f,
+  0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x05, 0xd2, 0x07, 0x80, 0x06, 0xef, 0xb2,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00,
+  0xf4, 0x0e, 0x0f, 0xff, 0xd6, 0x00, 0xf0, 0x04, 0xd6, 0x0f, 0x00, 0x04, 0xd0,
+  0xf0, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x4d, 0x0f, 0x00, 0x4e,
+  0x70, 0xff, 0xfd, 0x60, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x01, 0x00, 0xd1, 0x0f, 0xff, 0xff, 0x00, 0xf0, 0x00, 0x00, 0x0f,
+  0x00, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x05, 0x0e, 0x00, 0x24, 0xf0, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xd1,
+  0x0f, 0xff, 0xff, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xff, 0xff,
+  0x07, 0x00, 0x24, 0xf0, 0x00, 0x07, 0x00, 0x05, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x05, 0xcf, 0xff, 0x05,
+  0xd4, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xff,
+  0x0c, 0x50, 0x00, 0xf0, 0x4e, 0x40, 0x0f, 0x00, 0x4c, 0xff, 0xf0, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0x70, 0x0f,
+  0x00, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0x07, 0x00, 0x36, 0xff, 0xff, 0xf0, 0x0e,
+  0x00, 0x00, 0x07, 0x00, 0x14, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x01, 0x00, 0xab, 0x0f, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x00,
+  0x00, 0x0f, 0x00, 0x07, 0x00, 0x44, 0xff, 0xff, 0xf0, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xa7, 0x0f, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x07, 0x00, 0x84, 0x09, 0x50, 0x7d,
+  0x00, 0x5d, 0xfc, 0x30, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x01, 0x00, 0xf0, 0x03, 0x0f, 0x00, 0x0c, 0x70, 0xf0, 0x0c, 0x70,
+  0x0f, 0x0c, 0x80, 0x00, 0xfc, 0xf3, 0x00, 0x0f, 0x86, 0xd0, 0x00, 0x0e, 0x00,
+  0x74, 0x00, 0x2e, 0x10, 0xf0, 0x00, 0x8a, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0x5f, 0x0f, 0x00, 0x00, 0x00, 0xf0,
+  0x07, 0x00, 0x01, 0x44, 0xff, 0xff, 0xf0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0xfc, 0x00, 0x0d, 0xff,
+  0xc2, 0x03, 0xcf, 0xf6, 0x90, 0x96, 0xff, 0x0e, 0x1e, 0x0f, 0xf0, 0x9c, 0x90,
+  0xff, 0x03, 0xf3, 0x0f, 0xf0, 0x00, 0x00, 0xff, 0x00, 0x00, 0x0f, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e,
+  0x0f, 0x30, 0x0f, 0x00, 0xfa, 0x00, 0xf0, 0x0f, 0xa2, 0x0f, 0x00, 0xf3, 0xa0,
+  0xf0, 0x0f, 0x0c, 0x2f, 0x00, 0xf0, 0x59, 0xf0, 0x0f, 0x00, 0xdf, 0x00, 0xf0,
+  0x07, 0xf0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x01, 0x00, 0xf4, 0x0e, 0x03, 0xcf, 0xd5, 0x03, 0xe4, 0x03, 0xe4, 0xb5, 0x00,
+  0x04, 0xcf, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xfb, 0x50, 0x00, 0x4c, 0x3e,
+  0x40, 0x3d, 0x40, 0x3c, 0xfd, 0x50, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf6, 0x0c, 0x0f, 0xff, 0xfc, 0x30, 0xf0,
+  0x00, 0x6d, 0x0f, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x6c, 0x0f, 0xff, 0xfb, 0x20,
+  0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf0, 0x1b, 0x05, 0xdf, 0xd5,
+  0x04, 0xe4, 0x02, 0xd4, 0xc4, 0x00, 0x03, 0xcf, 0x00, 0x00, 0x0f, 0xf0, 0x00,
+  0x00, 0xfc, 0x50, 0x00, 0x3c, 0x4e, 0x50, 0x3d, 0x40, 0x5e, 0xff, 0x60, 0x00,
+  0x0b, 0x50, 0x00, 0x00, 0x1b, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x0f, 0xff, 0xfb, 0x20, 0xf0, 0x01, 0x7b,
+  0x0f, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x6e, 0x0f, 0xff, 0xfc, 0x40, 0xf0, 0x3e,
+  0x00, 0x0f, 0x00, 0xa8, 0x00, 0xf0, 0x01, 0xe2, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x03, 0xcf, 0xd4,
+  0x00, 0xe5, 0x04, 0xc0, 0x0d, 0x50, 0x00, 0x00, 0x2c, 0xc3, 0x00, 0x00, 0x04,
+  0xd7, 0x00, 0x00, 0x01, 0xe0, 0x0d, 0x50, 0x4e, 0x00, 0x3c, 0xfe, 0x40, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xbe,
+  0xff, 0xff, 0xff, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x07, 0x00,
+  0x04, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00,
+  0x7a, 0x0f, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0x07, 0x00, 0x84, 0x0c, 0x60,
+  0x5c, 0x00, 0x3d, 0xfd, 0x40, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x01, 0x00, 0xf5, 0x0d, 0x0e, 0x10, 0x2d, 0x00, 0xa4, 0x05,
+  0xa0, 0x07, 0x80, 0x96, 0x00, 0x3b, 0x0c, 0x30, 0x00, 0xe0, 0xe0, 0x00, 0x0c,
+  0x5b, 0x00, 0x00, 0x8c, 0x80, 0x00, 0x05, 0xf4, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0xf0, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0x0f, 0xf0, 0x2f, 0x20, 0xff, 0x08, 0xf8, 0x0f, 0xf0, 0xe9,
+  0xe0, 0xff, 0x3e, 0x0e, 0x3f, 0xcf, 0x90, 0x9f, 0xc4, 0xf3, 0x03, 0xf5, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4,
+  0x0e, 0xfa, 0x00, 0x0a, 0xf0, 0xd5, 0x05, 0xd0, 0x03, 0xe3, 0xe3, 0x00, 0x07,
+  0xf7, 0x00, 0x00, 0x7f, 0x70, 0x00, 0x3e, 0x2e, 0x30, 0x0d, 0x50, 0x4d, 0x0f,
+  0xa0, 0x00, 0xaf, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x00, 0x01, 0x00, 0xf1, 0x09, 0x1f, 0x20, 0x2f, 0x10, 0x98, 0x08, 0x90, 0x02,
+  0xe0, 0xe2, 0x00, 0x0a, 0xab, 0x00, 0x00, 0x3f, 0x30, 0x00, 0x00, 0xf0, 0x00,
+  0x00, 0x0f, 0x00, 0x07, 0x00, 0x04, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x05,
+  0xa0, 0x00, 0x01, 0xd1, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x1d,
+  0x10, 0x00, 0x0a, 0x50, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x9f, 0xff, 0xf0, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x07, 0x00, 0x07, 0x90, 0xff, 0xf0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf0, 0x1b, 0x1f,
+  0x20, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x04, 0xf0, 0x00, 0x00, 0x0e, 0x60, 0x00,
+  0x00, 0x8c, 0x00, 0x00, 0x01, 0xf2, 0x00, 0x00, 0x0b, 0x90, 0x00, 0x00, 0x4f,
+  0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x08, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x08, 0xa0, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xfe, 0x03, 0x4f, 0x70, 0x00, 0x0a,
+  0x6c, 0x00, 0x01, 0xb0, 0xb2, 0x00, 0x66, 0x07, 0x70, 0x0c, 0x10, 0x2c, 0x00,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x12, 0xb0, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xef, 0x00, 0x20, 0x00, 0x00, 0x1e, 0x40, 0x00, 0x00, 0x3e, 0x20, 0x00, 0x00,
+  0x10, 0x00, 0x01, 0x00, 0x0b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x01, 0x00, 0xf5, 0x06, 0x07, 0xef, 0xe5, 0x00, 0x42, 0x02, 0xe0, 0x04, 0xce,
+  0xff, 0x00, 0xe5, 0x20, 0xf0, 0x0f, 0x10, 0x0f, 0x00, 0xaf, 0xff, 0xf0, 0x1e,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0xf0,
+  0x00, 0x00, 0x0f, 0x07, 0x00, 0xf4, 0x06, 0x6e, 0xfb, 0x20, 0xfd, 0x10, 0x7b,
+  0x0f, 0x10, 0x00, 0xf0, 0xf0, 0x00, 0x1f, 0x0f, 0xd3, 0x1b, 0x90, 0xf6, 0xee,
+  0x80, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01,
+  0x00, 0xf5, 0x05, 0x9e, 0xfa, 0x10, 0xab, 0x20, 0x72, 0x0f, 0x10, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0x0a, 0xa1, 0x05, 0x10, 0x09, 0xef, 0xc2, 0x1d, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x00, 0x40, 0xf0, 0x00, 0x00,
+  0x0f, 0x07, 0x00, 0xf4, 0x07, 0x03, 0xdf, 0xff, 0x00, 0xc7, 0x00, 0xf0, 0x0f,
+  0x00, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0x0d, 0x60, 0x0f, 0x00, 0x4e, 0xff, 0xf0,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00,
+  0xf5, 0x06, 0x01, 0xbf, 0xe4, 0x00, 0xc5, 0x04, 0xe0, 0x0f, 0xff, 0xff, 0x00,
+  0xf0, 0x00, 0x00, 0x0a, 0x90, 0x4e, 0x00, 0x1b, 0xfd, 0x40, 0x1e, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xc0, 0x5e, 0xff, 0x00,
+  0x0d, 0x50, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0x07, 0x00, 0x38, 0x00,
+  0x0f, 0x00, 0x07, 0x00, 0x04, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x01, 0x00, 0xf0, 0x14, 0x06, 0xef, 0xff, 0xf0, 0xe3, 0x02, 0xf0,
+  0x0f, 0x20, 0x1f, 0x00, 0x9f, 0xff, 0x90, 0x0e, 0x10, 0x00, 0x00, 0xbf, 0xff,
+  0xe4, 0x0e, 0x10, 0x02, 0xe0, 0xf2, 0x00, 0x5d, 0x06, 0xef, 0xfb, 0x30, 0x00,
+  0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x07, 0x00,
+  0xd3, 0xcf, 0xf6, 0x00, 0xf5, 0x03, 0xe0, 0x0f, 0x00, 0x0f, 0x00, 0xf0, 0x00,
+  0xf0, 0x07, 0x00, 0x14, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x01, 0x00, 0x10, 0xf0, 0x05, 0x00, 0x62, 0x0f, 0xff, 0xf0, 0x00,
+  0x00, 0x0f, 0x0e, 0x00, 0x07, 0x07, 0x00, 0x03, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0x10, 0xb0, 0x05, 0x00, 0x9c, 0x0f,
+  0xff, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0xa0, 0x30, 0x7d,
+  0x00, 0x0b, 0xfd, 0x30, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0x0f, 0x07, 0x00, 0xf4, 0x05, 0x7f, 0x00, 0xf0, 0x6e, 0x20,
+  0x0f, 0x5f, 0x80, 0x00, 0xfe, 0x6f, 0x30, 0x0f, 0x30, 0x5e, 0x10, 0xf0, 0x00,
+  0x7f, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x64,
+  0x21, 0x10, 0x00, 0x8f, 0xf5, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x19, 0x00, 0x01, 0x00, 0xe3, 0xfc, 0xf7, 0xbf, 0x6f, 0x61, 0xf6, 0x1f,
+  0xf0, 0x0f, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0x07, 0x00, 0x05, 0x1e, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xe3, 0x0f, 0x8f, 0xe5,
+  0x00, 0xfa, 0x04, 0xe0, 0x0f, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0x07, 0x00,
+  0x05, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00,
+  0xf5, 0x06, 0x02, 0xcf, 0xd2, 0x00, 0xb7, 0x07, 0xc0, 0x0f, 0x00, 0x0f, 0x00,
+  0xf0, 0x01, 0xf0, 0x0b, 0x80, 0x8b, 0x00, 0x1c, 0xfc, 0x20, 0x1e, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf0, 0x14, 0x0f, 0xff,
+  0xe4, 0x00, 0xf0, 0x05, 0xd0, 0x0f, 0x00, 0x0f, 0x00, 0xf0, 0x01, 0xf0, 0x0f,
+  0x00, 0x7c, 0x00, 0xff, 0xfc, 0x30, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf0, 0x14,
+  0x04, 0xdf, 0xff, 0x00, 0xd5, 0x00, 0xf0, 0x0f, 0x00, 0x0f, 0x00, 0xf1, 0x00,
+  0xf0, 0x0c, 0x70, 0x0f, 0x00, 0x3c, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00,
+  0xf2, 0x00, 0xf7, 0xff, 0x80, 0x0f, 0xc1, 0x11, 0x00, 0xf1, 0x00, 0x00, 0x0f,
+  0x00, 0x00, 0x00, 0xf0, 0x07, 0x00, 0x04, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x05, 0xdf, 0xe6, 0x00, 0xf3,
+  0x03, 0x70, 0x09, 0xb7, 0x40, 0x00, 0x02, 0x5b, 0xa0, 0x07, 0x30, 0x2f, 0x00,
+  0x4b, 0xff, 0x80, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x01, 0x00, 0xb5, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00,
+  0x0f, 0x0e, 0x00, 0x84, 0x00, 0xe4, 0x02, 0x00, 0x05, 0xdf, 0xe3, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0x73, 0x0f,
+  0x00, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0x07, 0x00, 0x75, 0x0e, 0x40, 0xaf, 0x00,
+  0x5e, 0xf7, 0xf0, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x01, 0x00, 0xf6, 0x05, 0x1f, 0x20, 0x3f, 0x10, 0xb7, 0x09, 0xb0, 0x05, 0xc0,
+  0xe5, 0x00, 0x0e, 0x4e, 0x00, 0x00, 0x9e, 0x90, 0x00, 0x03, 0xf2, 0x1e, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0xf0,
+  0x2f, 0x20, 0xff, 0x06, 0xf6, 0x1f, 0xf0, 0xab, 0xa3, 0xff, 0x1e, 0x4d, 0x4f,
+  0xf6, 0xf0, 0xc7, 0xf8, 0xfb, 0x08, 0xf8, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x0d, 0x50, 0x4d, 0x00, 0x3d,
+  0x1d, 0x30, 0x00, 0x7e, 0x70, 0x00, 0x07, 0xe6, 0x00, 0x03, 0xd1, 0xe2, 0x00,
+  0xd4, 0x05, 0xc0, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x01, 0x00, 0xf0, 0x14, 0xf5, 0x00, 0x06, 0xf5, 0xd0, 0x00, 0xd7, 0x0c, 0x50,
+  0x4e, 0x00, 0x4d, 0x0b, 0x70, 0x00, 0xb8, 0xf1, 0x00, 0x02, 0xf8, 0x00, 0x00,
+  0x1f, 0x10, 0x03, 0x19, 0x80, 0x00, 0x8f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x0c, 0x80,
+  0x00, 0x0b, 0x90, 0x00, 0x0a, 0xb0, 0x00, 0x08, 0xc0, 0x00, 0x00, 0xff, 0xff,
+  0xf0, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00,
+  0xc1, 0x9f, 0xf0, 0x00, 0x0f, 0x20, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00,
+  0x07, 0x00, 0x28, 0xfd, 0x00, 0x0e, 0x00, 0x12, 0x0f, 0x23, 0x00, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x4f, 0xf0, 0x00, 0x00,
+  0x0f, 0x07, 0x00, 0x10, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0xd6, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0xf9, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x07, 0x00,
+  0x18, 0xdf, 0x0e, 0x00, 0xd0, 0x02, 0xf0, 0x00, 0x0f, 0xf9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x01, 0x00, 0x8e, 0x4f, 0x91, 0x60,
+  0x06, 0x07, 0xf8, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xac, 0x00, 0x00, 0x25, 0xf0, 0x00,
+  0x4c, 0x0f, 0x00, 0x04, 0xff, 0xf0, 0x00, 0x01, 0x00, 0x07, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xaf, 0x8f, 0x80, 0x00, 0x0f, 0x2f,
+  0x00, 0x00, 0x8f, 0x90, 0x00, 0x01, 0x00, 0x07, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x00, 0x01, 0x00, 0xb2, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xff,
+  0xff, 0xf0, 0x00, 0x0f, 0x0e, 0x00, 0x12, 0x00, 0x0e, 0x00, 0x04, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x01, 0x00, 0x2f, 0xf0, 0x00,
+  0x01, 0x00, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0xee, 0x50, 0x00, 0xf3, 0x3e, 0x00, 0x0f, 0x22, 0xe0, 0x00,
+  0x7f, 0xf7, 0x00, 0x01, 0x00, 0x07, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+  0x00, 0x01, 0x00, 0xf4, 0x0d, 0x0c, 0xff, 0xf0, 0x03, 0xcf, 0x00, 0x00, 0xa5,
+  0xf0, 0x00, 0x1e, 0x0f, 0xf0, 0x08, 0x80, 0xf0, 0x00, 0xef, 0xff, 0x00, 0x5c,
+  0x00, 0xf0, 0x0c, 0x40, 0x0f, 0xff, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x0f, 0xff, 0xc5, 0x00, 0xf0,
+  0x04, 0xe4, 0x0f, 0x00, 0x04, 0xcf, 0xff, 0xd0, 0x0f, 0x0f, 0x00, 0x00, 0xf0,
+  0xf0, 0x00, 0x4c, 0x0f, 0x00, 0x4e, 0x40, 0xff, 0xfc, 0x50, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xf5, 0x09, 0x10,
+  0x00, 0x20, 0x2f, 0x30, 0x6e, 0x10, 0x5f, 0x9f, 0x30, 0x00, 0x9f, 0x70, 0x00,
+  0x6f, 0x8f, 0x30, 0x2f, 0x30, 0x5f, 0x10, 0x10, 0x00, 0x20, 0x21, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x03, 0xcf,
+  0xa5, 0xf3, 0xe5, 0x06, 0xf7, 0xb5, 0x01, 0xe9, 0xcf, 0x00, 0xbb, 0x0f, 0xf1,
+  0x7e, 0x11, 0xfd, 0x9f, 0x40, 0x6c, 0x6f, 0xb0, 0x5f, 0x5f, 0x57, 0xfe, 0x60,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00,
+  0xf0, 0x06, 0x0f, 0x00, 0x00, 0x00, 0xff, 0xfd, 0x40, 0x0f, 0x00, 0x5d, 0x00,
+  0xf0, 0x00, 0xf0, 0x0f, 0x00, 0x6d, 0x00, 0xff, 0xfd, 0x30, 0x15, 0x00, 0x26,
+  0xf0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x5f, 0xf8, 0x00, 0x0d, 0x32, 0xf0, 0x00, 0xf0, 0x1d, 0x00,
+  0x0f, 0x09, 0x50, 0x00, 0xf0, 0xe3, 0x00, 0x0f, 0x06, 0xd3, 0x00, 0xf0, 0x02,
+  0xb7, 0x0f, 0x03, 0x02, 0xf0, 0xf1, 0xcf, 0xf9, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x6e, 0xe3, 0xaf,
+  0x72, 0x13, 0xd6, 0x2d, 0x07, 0xdf, 0x11, 0xe9, 0x71, 0xff, 0xff, 0xf1, 0x0f,
+  0x40, 0x18, 0xfd, 0x3a, 0xfc, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf4, 0x15, 0x00, 0x02, 0x00, 0x00, 0x00, 0x36, 0x61, 0x00, 0x05, 0x56, 0x00,
+  0x00, 0x00, 0x93, 0x01, 0xbf, 0xc6, 0xa0, 0xaa, 0x11, 0x7e, 0x0f, 0x10, 0x00,
+  0xf0, 0xf1, 0x00, 0x1e, 0x09, 0xb1, 0x1a, 0x90, 0x09, 0xff, 0xa0, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x12, 0x0f,
+  0x06, 0x00, 0x27, 0xff, 0xff, 0x0e, 0x00, 0x05, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x01, 0xbf, 0xc2, 0x90,
+  0xba, 0x20, 0x52, 0x0f, 0x10, 0x11, 0xc0, 0xc1, 0x10, 0x1f, 0x01, 0x60, 0x1a,
+  0xb0, 0x92, 0xcf, 0xb1, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83,
+  0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x07, 0x00, 0xf3, 0x05, 0x3e,
+  0xe3, 0x00, 0xf5, 0x07, 0xc0, 0x0f, 0x00, 0x0f, 0x00, 0xf0, 0x01, 0xf0, 0x0f,
+  0x40, 0x9a, 0x00, 0xf5, 0xfc, 0x10, 0x1c, 0x00, 0x70, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xef, 0x00, 0x20, 0x00, 0x00, 0x3e, 0x30, 0x00, 0x00, 0x4e,
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x0b, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xef, 0x00, 0x00, 0x10, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x2e, 0x30, 0x00,
+  0x00, 0x20, 0x00, 0x01, 0x00, 0x0b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0xf6, 0x00, 0x03, 0xe4, 0xe2, 0x00, 0x02, 0x01,
+  0x00, 0x01, 0x00, 0x0b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00,
+  0x00, 0x00, 0x9f, 0x61, 0xf0, 0x0f, 0x0a, 0xfa, 0x00, 0x01, 0x00, 0x0e, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0x4f, 0x0f, 0xff, 0xff,
+  0x00, 0x01, 0x00, 0x0e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01,
+  0x00, 0x3f, 0xf0, 0xf0, 0x00, 0x01, 0x00, 0x0e, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x70, 0x00, 0xbb, 0x00, 0x00, 0x0b, 0x11, 0x00, 0x07, 0x00, 0x0f, 0x01,
+  0x00, 0x0e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x10,
+  0xd0, 0x0f, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0xfd, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x00, 0x01, 0x00, 0xf7, 0x06, 0x0d, 0x20, 0x00, 0x05, 0xb0, 0x00,
+  0x00, 0xc3, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x0c, 0x50, 0x00, 0x03, 0xd0, 0x00,
+  0x00, 0xb6, 0x20, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01,
+  0x00, 0x9e, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x07, 0x00,
+  0x05, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00,
+  0xf4, 0x0d, 0x07, 0x00, 0x00, 0x01, 0xf1, 0x00, 0x00, 0x7e, 0x70, 0x00, 0x0d,
+  0x5d, 0x00, 0x03, 0xc0, 0xd2, 0x00, 0x96, 0x07, 0x80, 0x0e, 0x10, 0x1e, 0x05,
+  0xff, 0xff, 0xf4, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x00, 0x01, 0x00, 0xf4, 0x0e, 0x0f, 0xff, 0xff, 0x00, 0xa9, 0x00, 0x00, 0x01,
+  0xe5, 0x00, 0x00, 0x04, 0xe2, 0x00, 0x00, 0x4e, 0x10, 0x00, 0x1e, 0x50, 0x00,
+  0x0a, 0xa0, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf4, 0x0d, 0xaf, 0x90, 0x00, 0x78,
+  0x09, 0x50, 0x0c, 0x10, 0x3b, 0x00, 0xe0, 0x02, 0xe0, 0x0e, 0x00, 0x2e, 0x00,
+  0xa3, 0x04, 0xa0, 0x03, 0xb0, 0xb1, 0x00, 0xff, 0x1f, 0xd0, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x02,
+  0xce, 0xc2, 0xc0, 0xc7, 0x09, 0xd7, 0x1f, 0x00, 0x4f, 0x21, 0xf0, 0x03, 0xf0,
+  0x0f, 0x21, 0xad, 0x00, 0x6d, 0xfb, 0x6b, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xf0, 0x22, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xfd, 0x20, 0x0c, 0x61,
+  0x6a, 0x01, 0xf0, 0x02, 0xb0, 0x2f, 0x00, 0x86, 0x02, 0xf1, 0xdd, 0x20, 0x2f,
+  0x01, 0x9c, 0x02, 0xf0, 0x02, 0xe0, 0x2f, 0x31, 0x6d, 0x02, 0xfd, 0xfe, 0x50,
+  0x2f, 0x00, 0x00, 0x02, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x19, 0x00, 0x01, 0x00, 0xf0, 0x14, 0x0d, 0x20, 0x02, 0xd0, 0x78, 0x00,
+  0x68, 0x01, 0xd0, 0x0c, 0x20, 0x0b, 0x24, 0xa0, 0x00, 0x55, 0xb1, 0x00, 0x01,
+  0xe5, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xf4, 0x15, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xf0, 0x0f,
+  0x20, 0x00, 0x00, 0x6c, 0x20, 0x00, 0x00, 0x3d, 0x60, 0x00, 0x4a, 0x14, 0x91,
+  0x0d, 0x10, 0x03, 0xb0, 0xf0, 0x00, 0x1e, 0x0c, 0x52, 0x39, 0x90, 0x2b, 0xfe,
+  0x70, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01,
+  0x00, 0xf5, 0x06, 0x05, 0xac, 0xd8, 0x00, 0xe0, 0x00, 0x30, 0x09, 0xa4, 0x40,
+  0x00, 0xd6, 0x23, 0x00, 0x1f, 0x00, 0x06, 0x00, 0x7d, 0xff, 0xc1, 0x1e, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x0b, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0xff, 0xf4, 0x00, 0x00, 0x8f, 0x40, 0x02, 0xce, 0x70, 0x02, 0xeb, 0x00, 0x00,
+  0xcc, 0x00, 0x00, 0x1f, 0x30, 0x00, 0x03, 0xf1, 0x07, 0x00, 0xf0, 0x03, 0x00,
+  0x6e, 0x94, 0x00, 0x00, 0x03, 0x6d, 0x20, 0x00, 0x01, 0xe1, 0x00, 0x00, 0x14,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xe3, 0x0f, 0x7f, 0xe6, 0x00,
+  0xf9, 0x22, 0xe0, 0x0f, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0x07, 0x00, 0xe0,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf4, 0x15, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xfb, 0x00, 0x09, 0x92, 0xb7,
+  0x00, 0xe1, 0x04, 0xc0, 0x1f, 0x00, 0x2e, 0x01, 0xfe, 0xee, 0xf0, 0x1f, 0x11,
+  0x4e, 0x00, 0xf1, 0x03, 0xd0, 0x0a, 0x92, 0xa8, 0x00, 0x1c, 0xfb, 0x10, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x15, 0x00, 0x00, 0x00,
+  0x08, 0xf9, 0x00, 0x00, 0x12, 0xc5, 0x00, 0x00, 0x03, 0xd0, 0x00, 0x00, 0x3f,
+  0x50, 0x00, 0x09, 0xac, 0x00, 0x00, 0xe1, 0xc4, 0x00, 0x5c, 0x05, 0xc0, 0x0b,
+  0x70, 0x0d, 0x31, 0xf2, 0x00, 0x7b, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0x74, 0x0f, 0x00, 0x0f, 0x00, 0xf0, 0x00,
+  0xf0, 0x07, 0x00, 0xf0, 0x05, 0x20, 0x0f, 0x00, 0xff, 0xff, 0xfd, 0x0f, 0x00,
+  0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+  0x00, 0x01, 0x00, 0xb5, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0x00, 0xf0, 0x0f, 0x00,
+  0x0f, 0x00, 0x07, 0x00, 0x15, 0xde, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x19, 0x00, 0x01, 0x00, 0xf0, 0x14, 0x04, 0xcf, 0xe7, 0x00, 0xf7, 0x01,
+  0xa8, 0x1f, 0x00, 0x02, 0xd2, 0xf0, 0x00, 0x2d, 0x2f, 0x70, 0x0a, 0x72, 0xf6,
+  0xcd, 0x80, 0x2f, 0x00, 0x00, 0x02, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x03, 0xdf, 0xff, 0xd0,
+  0xc5, 0x05, 0xc0, 0x0f, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0x0d, 0x40, 0x4c,
+  0x00, 0x3d, 0xfd, 0x30, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+  0x00, 0x01, 0x00, 0xf0, 0x14, 0x0e, 0x40, 0x4e, 0x00, 0x5d, 0x0c, 0x50, 0x00,
+  0xca, 0xc0, 0x00, 0x03, 0xf3, 0x00, 0x00, 0x6f, 0x60, 0x00, 0x0e, 0x5e, 0x00,
+  0x07, 0xb0, 0xa7, 0x00, 0xe4, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x2d, 0x00, 0x0c, 0x28, 0x60, 0x00,
+  0x69, 0xe1, 0x0e, 0x01, 0xef, 0x00, 0xe0, 0x0e, 0xd5, 0x2f, 0x24, 0xc4, 0xef,
+  0x6d, 0xe4, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01,
+  0x00, 0x40, 0xff, 0xff, 0x00, 0x0f, 0x07, 0x00, 0x11, 0xf0, 0x07, 0x00, 0x65,
+  0xf0, 0x00, 0x00, 0x0f, 0xff, 0xf0, 0x1d, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x00, 0x01, 0x00, 0xf6, 0x07, 0xd4, 0x00, 0x00, 0x03, 0xd4, 0x00,
+  0x00, 0x01, 0xc5, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x01, 0xc6, 0x00, 0x02, 0xd5,
+  0x00, 0x00, 0xe5, 0x20, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x01, 0x00, 0xf9, 0x02, 0x0c, 0xcc, 0xdf, 0x00, 0x00, 0x2c, 0xd0, 0x00, 0x3d,
+  0x2c, 0x00, 0x4e, 0x30, 0xc0, 0x0f, 0x40, 0x0c, 0x1e, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf9, 0x02, 0x0f, 0x30, 0x0c, 0x00,
+  0x4e, 0x30, 0xc0, 0x00, 0x3d, 0x2c, 0x00, 0x00, 0x3c, 0xd0, 0x0d, 0xdd, 0xdf,
+  0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf0,
+  0x1b, 0x0f, 0xff, 0xff, 0x00, 0x96, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x02,
+  0xc0, 0x00, 0x00, 0x05, 0xa0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3c, 0x00, 0x00,
+  0x0c, 0x20, 0x00, 0x0a, 0x50, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf0, 0x22, 0x00, 0x00, 0x0c, 0xc0, 0x00, 0x01, 0xb0,
+  0x00, 0x00, 0x58, 0x00, 0x00, 0x08, 0x40, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x0d,
+  0x00, 0xff, 0x22, 0xa0, 0x00, 0x97, 0x57, 0x00, 0x03, 0xb8, 0x40, 0x00, 0x0d,
+  0xc0, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x00, 0xf8, 0x00, 0x08, 0xfc, 0x2c, 0xf6,
+  0xd0, 0x5f, 0x40, 0xdc, 0x17, 0xe6, 0x2d, 0x7f, 0xc1, 0xcf, 0x60, 0x1b, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xcb, 0xbf, 0xf0,
+  0x00, 0x0f, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x07, 0x00, 0x51,
+  0xf1, 0xf0, 0x00, 0x0f, 0xfc, 0x25, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0x70, 0x07, 0xf9, 0x1f, 0x00, 0xe1, 0x7f,
+  0xb0, 0x0b, 0x00, 0x69, 0x7f, 0x91, 0xf0, 0x0e, 0x17, 0xfb, 0x1e, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0xf0, 0x04, 0x06, 0x00,
+  0x00, 0x5d, 0xd0, 0x04, 0xcd, 0x50, 0x00, 0xfa, 0x00, 0x00, 0x04, 0xdd, 0x50,
+  0x00, 0x00, 0x5e, 0xc0, 0x15, 0x00, 0x35, 0xff, 0xff, 0xf0, 0x23, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf0, 0x02, 0x06, 0x00,
+  0x00, 0x00, 0xdd, 0x50, 0x00, 0x00, 0x6d, 0xc3, 0x00, 0x00, 0x0b, 0xf0, 0x00,
+  0x5d, 0xc4, 0x0e, 0x00, 0x00, 0x15, 0x00, 0x44, 0xff, 0xff, 0xf0, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e,
+  0x0f, 0xaa, 0xac, 0xa0, 0xb6, 0x00, 0x6a, 0x0a, 0x42, 0x50, 0xa0, 0xa0, 0x85,
+  0x0a, 0x0a, 0x08, 0x60, 0xa0, 0xa6, 0x04, 0x2a, 0x0c, 0x40, 0x06, 0xa0, 0xf9,
+  0x99, 0xba, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x01, 0x00, 0xf1, 0x07, 0x03, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x57, 0x00,
+  0x00, 0x0c, 0x00, 0x00, 0x06, 0x70, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x07, 0x70,
+  0x0e, 0x00, 0x22, 0x00, 0x57, 0x1c, 0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf1, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0xa0, 0x00, 0x00, 0x07, 0x50, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x66,
+  0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x57, 0x0e, 0x00, 0xf0, 0x02, 0x06, 0x60,
+  0x00, 0x00, 0xb0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x0f, 0xaa, 0xac, 0xa0, 0xb6,
+  0x00, 0x6a, 0x0a, 0x42, 0x50, 0xa0, 0xa0, 0x85, 0x0a, 0x0a, 0x08, 0x60, 0xa0,
+  0xa6, 0x04, 0x2a, 0x0c, 0x40, 0x06, 0xa0, 0xf9, 0x99, 0xba, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+#if KANDINSKY_FONT_VARIABLE_WIDTH
+constexpr static uint8_t glyphWidths[numberOfCodePoints + 1] = {
+  0x07, 0x07, 0x07, 0x08, 0x07, 0x08, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x07, 0x07, 0x07, 0x08, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07,
+  0x08, 0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x07,
+  0x07, 0x08, 0x07, 0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x07, 0x08, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x07, 0x08,
+  0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00
+};
+#endif
+
+const KDFont KDFont::privateSmallFont(
+  SmallFont::k_glyphWidth,
+  SmallFont::k_glyphHeight,
+  glyphDataOffset,
+#if KANDINSKY_FONT_VARIABLE_WIDTH
+  glyphWidths,
+#endif
+  glyphData
+);
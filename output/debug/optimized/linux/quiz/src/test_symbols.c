@@ -0,0 +1,1709 @@
+#include <string.h>
+#include "symbols.h"
+
+void quiz_case_shared_alignment_handling();
+void quiz_case_shared_curve_drawing_adaptive_step();
+void quiz_case_shared_interval_values();
+void quiz_case_calculation_store();
+void quiz_case_calculation_ans();
+void quiz_case_calculation_significant_digits();
+void quiz_case_calculation_display_exact_approximate();
+void quiz_case_calculation_big_expressions();
+void quiz_case_calculation_symbolic_computation();
+void quiz_case_calculation_symbolic_computation_and_parametered_expressions();
+void quiz_case_calculation_complex_format();
+void quiz_case_calculation_involving_sequence();
+void quiz_case_calculation_additional_results();
+void quiz_case_graph_caching();
+void quiz_case_graph_list_default_function_name();
+void quiz_case_graph_list_valid_function_name();
+void quiz_case_graph_cartesian_function_type();
+void quiz_case_graph_polar_line_type();
+void quiz_case_graph_function_properties();
+void quiz_case_graph_function_properties_with_predefined_variables();
+void quiz_case_code_clipboard_enters_and_exits_python();
+void quiz_case_code_variable_box();
+void quiz_case_code_template();
+void quiz_case_statistics();
+void quiz_case_statistics_multiple_series();
+void quiz_case_statistics_histograms();
+void quiz_case_distributions_results_binomial();
+void quiz_case_distributions_results_uniform();
+void quiz_case_distributions_results_exponential();
+void quiz_case_distributions_results_normal();
+void quiz_case_distributions_results_chi_squared();
+void quiz_case_distributions_results_student();
+void quiz_case_distributions_results_geometric();
+void quiz_case_distributions_results_hypergeometric();
+void quiz_case_distributions_results_poisson();
+void quiz_case_distributions_results_fisher();
+void quiz_case_distributions_parameters_binomial();
+void quiz_case_distributions_parameters_uniform();
+void quiz_case_distributions_parameters_exponential();
+void quiz_case_distributions_parameters_normal();
+void quiz_case_distributions_parameters_chi_squared();
+void quiz_case_distributions_parameters_student();
+void quiz_case_distributions_parameters_geometric();
+void quiz_case_distributions_parameters_hypergeometric();
+void quiz_case_distributions_parameters_poisson();
+void quiz_case_distributions_parameters_fisher();
+void quiz_case_inference_one_proportion_statistic();
+void quiz_case_inference_one_mean_t_statistic();
+void quiz_case_inference_one_mean_z_statistic();
+void quiz_case_inference_two_proportions_statistic();
+void quiz_case_inference_two_means_t_statistic();
+void quiz_case_inference_pooled_t_test();
+void quiz_case_inference_two_means_z_statistic();
+void quiz_case_inference_goodness_test();
+void quiz_case_inference_homogeneity_test();
+void quiz_case_inference_slope_t_statistic();
+void quiz_case_inference_one_mean_t_with_table();
+void quiz_case_solver_error();
+void quiz_case_solver_linear_system();
+void quiz_case_solver_quadratic();
+void quiz_case_solver_cubic();
+void quiz_case_solver_quadratic_real();
+void quiz_case_solver_cubic_real();
+void quiz_case_solver_approximate();
+void quiz_case_solver_complex_real();
+void quiz_case_solver_complex_cartesian();
+void quiz_case_solver_complex_polar();
+void quiz_case_solver_symbolic_computation();
+void quiz_case_solver_solving_range();
+void quiz_case_sequence_evaluation();
+void quiz_case_sequence_context();
+void quiz_case_sequence_order();
+void quiz_case_sequence_evaluation_at_distant_ranks();
+void quiz_case_sequence_sum_evaluation();
+void quiz_case_sequence_suitable_for_cobweb();
+void quiz_case_regression_linear();
+void quiz_case_regression_linear_2();
+void quiz_case_regression_linear_3();
+void quiz_case_regression_proportional();
+void quiz_case_regression_proportional_2();
+void quiz_case_regression_proportional_3();
+void quiz_case_regression_proportional_4();
+void quiz_case_regression_proportional_5();
+void quiz_case_regression_quadratic();
+void quiz_case_regression_quadratic_2();
+void quiz_case_regression_cubic();
+void quiz_case_regression_cubic_2();
+void quiz_case_regression_cubic_3();
+void quiz_case_regression_quartic();
+void quiz_case_regression_logarithmic();
+void quiz_case_regression_exponential();
+void quiz_case_regression_exponential_2();
+void quiz_case_regression_exponential_3();
+void quiz_case_regression_exponential_4();
+void quiz_case_regression_exponential_5();
+void quiz_case_regression_exponential_abx();
+void quiz_case_regression_power();
+void quiz_case_regression_median_0();
+void quiz_case_regression_median_1();
+void quiz_case_regression_median_2();
+void quiz_case_regression_trigonometric_1();
+void quiz_case_regression_trigonometric_2();
+void quiz_case_regression_trigonometric_3();
+void quiz_case_regression_trigonometric_4();
+void quiz_case_regression_trigonometric_4_bis();
+void quiz_case_regression_trigonometric_5();
+void quiz_case_regression_trigonometric_6();
+void quiz_case_regression_trigonometric_7();
+void quiz_case_regression_trigonometric_8();
+void quiz_case_regression_logistic();
+void quiz_case_regression_column_calculation();
+void quiz_case_regression_constant_column_calculation();
+void quiz_case_regression_calculation();
+void quiz_case_finance_simple_interest();
+void quiz_case_finance_compound_interest();
+void quiz_case_escher_layout_field_select_left_right();
+void quiz_case_escher_layout_field_select_up_down();
+void quiz_case_escher_layout_field_unselect();
+void quiz_case_escher_layout_field_delete();
+void quiz_case_escher_dirty_region();
+void quiz_case_escher_view_redraw_distant_rects();
+void quiz_case_escher_view_scroll_pixels();
+void quiz_case_ion_crc32();
+void quiz_case_ion_events_from_keyboard();
+void quiz_case_ion_exam_bytes();
+void quiz_case_ion_exam_mode_uninitialized();
+void quiz_case_ion_exam_mode();
+void quiz_case_ion_keyboard();
+void quiz_case_ion_storage_records_crc32();
+void quiz_case_ion_storage_store_and_destroy_record();
+void quiz_case_ion_storage_put_record_twice();
+void quiz_case_ion_storage_invalid_renaming();
+void quiz_case_ion_storage_valid_renaming();
+void quiz_case_ion_storage_available_space_moving();
+void quiz_case_ion_storage_record_name_verifier();
+void quiz_case_ion_storage_disabled_records();
+void quiz_case_ion_storage_many_records();
+void quiz_case_ion_storage_benchmark_lookups();
+void quiz_case_ion_storage_records_with_extension_at_index();
+void quiz_case_kandinsky_color_rgb();
+void quiz_case_kandinsky_color_blend();
+void quiz_case_kandinsky_color_hsv();
+void quiz_case_kandinsky_font_index_for_code_point();
+void quiz_case_kandinsky_draw_string_benchmark();
+void quiz_case_kandinsky_rect_intersect();
+void quiz_case_kandinsky_rect_union();
+void quiz_case_kandinsky_rect_empty_union();
+void quiz_case_kandinsky_rect_difference();
+void quiz_case_omg_arithmetic_gcd();
+void quiz_case_omg_bit_helper();
+void quiz_case_omg_memory_insert_simple_swap();
+void quiz_case_omg_memory_rotate();
+void quiz_case_omg_print_integer();
+void quiz_case_omg_print_int_left();
+void quiz_case_omg_print_int_right();
+void quiz_case_omg_ring_buffer();
+void quiz_case_omg_signaling_nan();
+void quiz_case_ion_utf8_code_point_system_parentheses();
+void quiz_case_ion_utf8_decode_forward();
+void quiz_case_ion_utf8_decode_invalid_code_point();
+void quiz_case_ion_utf8_decode_backwards();
+void quiz_case_ion_utf8_decoder_next_glyph();
+void quiz_case_ion_utf8_decoder_previous_glyph();
+void quiz_case_ion_utf8_decoder_code_point();
+void quiz_case_ion_utf8_decoder_is_the_end_of_a_code_point();
+void quiz_case_ion_utf8_helper_count_occurrences();
+void quiz_case_ion_utf8_helper_code_point_search();
+void quiz_case_ion_utf8_helper_not_code_point_search();
+void quiz_case_ion_utf8_copy_and_remove_code_point();
+void quiz_case_ion_utf8_remove_code_point();
+void quiz_case_ion_utf8_move_string_from_index_by_number_of_char();
+void quiz_case_ion_utf8_try_and_replace_pattern_in_string_by_pattern();
+void quiz_case_ion_utf8_helper_copy_until_code_point();
+void quiz_case_ion_utf8_helper_previous_code_point_is();
+void quiz_case_ion_utf8_helper_code_point_is();
+void quiz_case_ion_utf8_helper_remove_previous_glyph();
+void quiz_case_ion_utf8_code_point_at_glyph_offset();
+void quiz_case_ion_utf8_glyph_offset_at_code_point();
+void quiz_case_ion_utf8_helper_string_codepoint_length();
+void quiz_case_ion_utf8_helper_string_glyph_length();
+void quiz_case_ion_utf8_helper_beginning_of_word();
+void quiz_case_ion_utf8_helper_end_of_word();
+void quiz_case_ion_utf8_helper_is_prefix();
+void quiz_case_poincare_additional_results_numerical_values();
+void quiz_case_poincare_additional_results_generalization();
+void quiz_case_poincare_approximation_decimal();
+void quiz_case_poincare_approximation_based_integer();
+void quiz_case_poincare_approximation_rational();
+void quiz_case_poincare_approximation_float();
+void quiz_case_poincare_approximation_infinity();
+void quiz_case_poincare_approximation_addition();
+void quiz_case_poincare_approximation_multiplication();
+void quiz_case_poincare_approximation_power();
+void quiz_case_poincare_approximation_subtraction();
+void quiz_case_poincare_approximation_constant();
+void quiz_case_poincare_approximation_division();
+void quiz_case_poincare_approximation_logarithm();
+void quiz_case_poincare_approximation_function();
+void quiz_case_poincare_approximation_unique_random();
+void quiz_case_poincare_approximation_integral();
+void quiz_case_poincare_approximation_trigonometry_functions();
+void quiz_case_poincare_approximation_matrix();
+void quiz_case_poincare_approximation_list();
+void quiz_case_poincare_approximation_list_sequence();
+void quiz_case_poincare_approximation_map_on_list();
+void quiz_case_poincare_approximation_probability();
+void quiz_case_poincare_approximation_complex_format();
+void quiz_case_poincare_approximation_mix();
+void quiz_case_poincare_approximation_lists_access();
+void quiz_case_poincare_approximation_lists_functions();
+void quiz_case_poincare_approximation_mixed_fraction();
+void quiz_case_poincare_approximation_floor_ceil_integer();
+void quiz_case_poincare_approximation_booleans();
+void quiz_case_poincare_approximation_comparison_operators();
+void quiz_case_poincare_approximation_piecewise_operator();
+void quiz_case_poincare_approximation_point();
+void quiz_case_poincare_approximation_keeping_symbols();
+void quiz_case_poincare_arithmetic_gcd();
+void quiz_case_poincare_arithmetic_lcm();
+void quiz_case_poincare_arithmetic_factorization();
+void quiz_case_poincare_arithmetic_divisors();
+void quiz_case_poincare_conics_cartesian_canonic();
+void quiz_case_poincare_conics_cartesian_invalid();
+void quiz_case_poincare_conics_cartesian_general();
+void quiz_case_poincare_conics_cartesian_reduction();
+void quiz_case_poincare_conics_polar_shape();
+void quiz_case_poincare_conics_parametric_shape();
+void quiz_case_poincare_no_dependency();
+void quiz_case_poincare_dependency_function();
+void quiz_case_poincare_dependency_derivative();
+void quiz_case_poincare_dependency_parametered_expression();
+void quiz_case_poincare_dependency_sequence();
+void quiz_case_poincare_dependency_power();
+void quiz_case_poincare_dependency_multiplication();
+void quiz_case_poincare_dependency_trigonometry();
+void quiz_case_poincare_derivative_formal();
+void quiz_case_poincare_derivative_formal_higher_order();
+void quiz_case_poincare_derivative_reduced_approximation();
+void quiz_case_poincare_derivative_approximation();
+void quiz_case_poincare_derivative_approximation_higher_order();
+void quiz_case_poincare_student_distribution();
+void quiz_case_poincare_chi2_distribution();
+void quiz_case_poincare_normal_distribution_find_parameters();
+void quiz_case_poincare_distribution_infinity();
+void quiz_case_poincare_erf_inv();
+void quiz_case_poincare_exam_modes();
+void quiz_case_poincare_expression_order_constant();
+void quiz_case_poincare_expression_order_decimal();
+void quiz_case_poincare_expression_order_rational();
+void quiz_case_poincare_expression_order_float();
+void quiz_case_poincare_expression_order_power();
+void quiz_case_poincare_expression_order_symbol();
+void quiz_case_poincare_expression_order_function();
+void quiz_case_poincare_expression_order_mix();
+void quiz_case_poincare_expression_order_addition_multiplication();
+void quiz_case_poincare_properties_is_number();
+void quiz_case_poincare_properties_is_rational_number();
+void quiz_case_poincare_properties_has_random();
+void quiz_case_poincare_properties_is_parametered_expression();
+void quiz_case_poincare_properties_has_approximate();
+void quiz_case_poincare_properties_has_matrix();
+void quiz_case_poincare_properties_is_infinity();
+void quiz_case_poincare_properties_get_variables();
+void quiz_case_poincare_properties_get_polynomial_coefficients();
+void quiz_case_poincare_properties_children_list_length();
+void quiz_case_poincare_properties_list_of_points();
+void quiz_case_poincare_properties_is_continuous();
+void quiz_case_poincare_properties_deep_is_symbolic();
+void quiz_case_poincare_serialization_based_integer();
+void quiz_case_poincare_serialization_rational();
+void quiz_case_poincare_serialization_decimal();
+void quiz_case_poincare_serialization_float();
+void quiz_case_poincare_serialization_division();
+void quiz_case_poincare_serialization_factorial();
+void quiz_case_poincare_serialization_percent();
+void quiz_case_poincare_serialization_power();
+void quiz_case_poincare_serialization_derivative();
+void quiz_case_poincare_expression_to_layout();
+void quiz_case_poincare_expression_to_layout_multiplication_operator();
+void quiz_case_poincare_expression_to_layout_implicit_addition();
+void quiz_case_poincare_expression_to_layout_serializes_to_self();
+void quiz_case_poincare_expression_to_layout_mixed_fraction();
+void quiz_case_poincare_layout_constructors();
+void quiz_case_poincare_layout_comparison();
+void quiz_case_poincare_layout_serialization();
+void quiz_case_poincare_layout_to_expression_unparsable();
+void quiz_case_poincare_layout_to_expression_parsable();
+void quiz_case_poincare_matrix_rank();
+void quiz_case_poincare_matrix_undef();
+void quiz_case_poincare_solver_roots();
+void quiz_case_poincare_solver_minima();
+void quiz_case_poincare_solver_maxima();
+void quiz_case_poincare_solver_intersections();
+void quiz_case_poincare_parsing_tokenize_numbers();
+void quiz_case_poincare_parsing_memory_exhaustion();
+void quiz_case_poincare_parsing_parse_numbers();
+void quiz_case_poincare_parsing_parse();
+void quiz_case_poincare_parsing_matrices();
+void quiz_case_poincare_parsing_lists();
+void quiz_case_poincare_parsing_lists_access();
+void quiz_case_poincare_parsing_constants();
+void quiz_case_poincare_parsing_units();
+void quiz_case_poincare_parsing_identifiers();
+void quiz_case_poincare_parsing_derivative_apostrophe();
+void quiz_case_poincare_parsing_parse_store();
+void quiz_case_poincare_parsing_parse_unit_convert();
+void quiz_case_poincare_parsing_implicit_multiplication();
+void quiz_case_poincare_parsing_with_missing_parentheses();
+void quiz_case_poincare_parsing_mixed_fraction();
+void quiz_case_poincare_parsing_function_assignment();
+void quiz_case_poincare_parsing_east_arrows();
+void quiz_case_poincare_parsing_logic();
+void quiz_case_poincare_parsing_points();
+void quiz_case_poincare_print_custom_print();
+void quiz_case_poincare_print_float();
+void quiz_case_poincare_range_1d_validity();
+void quiz_case_poincare_range_1d_geometry();
+void quiz_case_poincare_range_1d_make_valid();
+void quiz_case_poincare_range_1d_set_bound();
+void quiz_case_poincare_range_1d_extend();
+void quiz_case_poincare_range_1d_zoom();
+void quiz_case_poincare_rational_order();
+void quiz_case_poincare_rational_addition();
+void quiz_case_poincare_rational_power();
+void quiz_case_poincare_regularized_incomplete_beta_function();
+void quiz_case_poincare_regularized_gamma();
+void quiz_case_poincare_simplification_based_integer();
+void quiz_case_poincare_simplification_decimal();
+void quiz_case_poincare_simplification_rational();
+void quiz_case_poincare_simplification_infinity();
+void quiz_case_poincare_simplification_addition();
+void quiz_case_poincare_simplification_multiplication();
+void quiz_case_poincare_simplification_units();
+void quiz_case_poincare_simplification_power();
+void quiz_case_poincare_simplification_factorial();
+void quiz_case_poincare_simplification_percent();
+void quiz_case_poincare_simplification_logarithm();
+void quiz_case_poincare_simplification_random();
+void quiz_case_poincare_simplification_randint();
+void quiz_case_poincare_simplification_function();
+void quiz_case_poincare_simplification_trigonometry_functions();
+void quiz_case_poincare_simplification_matrix();
+void quiz_case_poincare_simplification_functions_of_matrices();
+void quiz_case_poincare_simplification_store();
+void quiz_case_poincare_simplification_store_matrix();
+void quiz_case_poincare_simplification_store_correctly_parsed();
+void quiz_case_poincare_simplification_unit_convert();
+void quiz_case_poincare_simplification_complex_format();
+void quiz_case_poincare_simplification_reduction_target();
+void quiz_case_poincare_simplification_user_function();
+void quiz_case_poincare_simplification_mix();
+void quiz_case_poincare_hyperbolic_trigonometry();
+void quiz_case_poincare_advanced_trigonometry();
+void quiz_case_poincare_probability();
+void quiz_case_poincare_simplification_system_circuit_breaker_handled();
+void quiz_case_poincare_simplification_list();
+void quiz_case_poincare_simplification_functions_of_lists();
+void quiz_case_poincare_simplification_mix_lists();
+void quiz_case_poincare_simplification_mixed_fraction();
+void quiz_case_poincare_simplification_booleans();
+void quiz_case_poincare_simplification_comparison_operators();
+void quiz_case_poincare_simplification_logical_operators();
+void quiz_case_poincare_simplification_piecewise_operator();
+void quiz_case_poincare_simplification_integral();
+void quiz_case_poincare_simplification_point();
+void quiz_case_poincare_pool_handle_are_discared_after_block();
+void quiz_case_poincare_pool_handle_are_discared_after_function_call();
+void quiz_case_poincare_pool_handle_can_be_copied();
+void quiz_case_poincare_pool_handle_can_be_moved();
+void quiz_case_poincare_pool_object_release();
+void quiz_case_poincare_pool_handle_can_be_returned();
+void quiz_case_poincare_pool_handle_memory_failure();
+void quiz_case_poincare_pool_handle_does_not_copy();
+void quiz_case_poincare_pool_expression_can_start_uninitialized();
+void quiz_case_poincare_pool_expression_can_be_copied_even_if_uninitialized();
+void quiz_case_poincare_zoom_fit_points_of_interest();
+void quiz_case_poincare_zoom_fit_intersections();
+void quiz_case_poincare_zoom_sanitation();
+void quiz_case_pcj_approximation_can_approximate();
+void quiz_case_pcj_approximation_scalar();
+void quiz_case_pcj_approximation_boolean();
+void quiz_case_pcj_approximation_replace();
+void quiz_case_pcj_approximation_power();
+void quiz_case_pcj_approximation_list();
+void quiz_case_pcj_approximation_matrix();
+void quiz_case_pcj_approximation_infinity();
+void quiz_case_pcj_approximation_units();
+void quiz_case_pcj_approximation_trigonometry();
+void quiz_case_pcj_approximation_arithmetic();
+void quiz_case_pcj_approximation_parametrics();
+void quiz_case_pcj_approximation_integrals();
+void quiz_case_pcj_approximation_derivatives();
+void quiz_case_pcj_approximation_percent();
+void quiz_case_pcj_approximation_decimal();
+void quiz_case_pcj_approximation_with_context();
+void quiz_case_pcj_prepare_function();
+void quiz_case_pcj_prepare_expression();
+void quiz_case_pcj_approximation_program();
+void quiz_case_pcj_approximation_program_benchmark();
+void quiz_case_pcj_beautification();
+void quiz_case_pcj_beautification_complex();
+void quiz_case_pcj_bounds_sign();
+void quiz_case_pcj_dimension();
+void quiz_case_pcj_equation_solver();
+void quiz_case_pcj_equation_solver_auto_range();
+void quiz_case_pcj_integer_constructor();
+void quiz_case_pcj_integer_properties();
+void quiz_case_pcj_integer_compare();
+void quiz_case_pcj_integer_set_sign();
+void quiz_case_pcj_integer_addition();
+void quiz_case_pcj_integer_subtraction();
+void quiz_case_pcj_integer_multiplication();
+void quiz_case_pcj_integer_divide();
+void quiz_case_pcj_integer_pow();
+void quiz_case_pcj_integer_factorial();
+void quiz_case_pcj_integer_gcd();
+void quiz_case_pcj_integer_overflows();
+void quiz_case_pcj_integer_cast();
+void quiz_case_pcj_integer_serialize();
+void quiz_case_pcj_k_tree();
+void quiz_case_pcj_k_tree_integer();
+void quiz_case_pcj_k_tree_rational_ranges();
+void quiz_case_pcj_k_tree_ternary();
+void quiz_case_pcj_k_codepoints();
+void quiz_case_pcj_k_rack();
+void quiz_case_pcj_k_tree_to_tree_pointer();
+void quiz_case_pcj_k_tree_arbitrary_data();
+void quiz_case_pcj_latex_parser_latex_to_layout();
+void quiz_case_pcj_latex_parser_layout_to_latex();
+void quiz_case_pcj_expression_to_layout();
+void quiz_case_pcj_layout_decoder();
+void quiz_case_pcj_omg_code_point();
+void quiz_case_pcj_layout_multiplication_symbol();
+void quiz_case_pcj_k_matrix_l();
+void quiz_case_pcj_layout_serialization();
+void quiz_case_pcj_layout_rack_cache();
+void quiz_case_pcj_context();
+void quiz_case_pcj_match();
+void quiz_case_pcj_rewrite_replace();
+void quiz_case_pcj_match_n_ary();
+void quiz_case_pcj_matrix();
+void quiz_case_pcj_block();
+void quiz_case_pcj_type_block();
+void quiz_case_pcj_constexpr_tree_constructor();
+void quiz_case_pcj_edition_node_constructor();
+void quiz_case_pcj_node_iterator();
+void quiz_case_pcj_node();
+void quiz_case_pcj_node_size();
+void quiz_case_pcj_tree_ancestors();
+void quiz_case_pcj_constructor();
+void quiz_case_pcj_pushers();
+void quiz_case_pcj_n_ary_manipulation();
+void quiz_case_pcj_order();
+void quiz_case_pcj_sort();
+void quiz_case_pcj_subtree();
+void quiz_case_pcj_parse_layout_tokenize();
+void quiz_case_pcj_parse_layout();
+void quiz_case_pcj_parse_unit();
+void quiz_case_pcj_parse_assignment();
+void quiz_case_pcj_parse_mixed_fraction();
+void quiz_case_pcj_parse_parametric();
+void quiz_case_pcj_parse_sequences();
+void quiz_case_pcj_polynomial_operations();
+void quiz_case_pcj_polynomial_degree();
+void quiz_case_pcj_projection();
+void quiz_case_pcj_random_seeds();
+void quiz_case_pcj_random_range_values();
+void quiz_case_pcj_rational_properties();
+void quiz_case_pcj_rational_set_sign();
+void quiz_case_pcj_rational_sign_of_ln();
+void quiz_case_pcj_rational_irreducible_form();
+void quiz_case_pcj_rational_addition();
+void quiz_case_pcj_rational_multiplication();
+void quiz_case_pcj_rational_integer_power();
+void quiz_case_pcj_rational_create_mixed_fraction();
+void quiz_case_pcj_roots();
+void quiz_case_pcj_expression_serialization();
+void quiz_case_pcj_expression_or_float_serialization();
+void quiz_case_pcj_set();
+void quiz_case_pcj_sign_methods();
+void quiz_case_pcj_sign();
+void quiz_case_pcj_sign_is_zero();
+void quiz_case_pcj_sign_is_positive();
+void quiz_case_pcj_sign_reduced_is_positive();
+void quiz_case_pcj_sign_set();
+void quiz_case_pcj_sign_is_real();
+void quiz_case_pcj_simplification_expansion();
+void quiz_case_pcj_simplification_algebraic_expansion();
+void quiz_case_pcj_simplification_contraction();
+void quiz_case_pcj_simplification_variables();
+void quiz_case_pcj_replace_symbol_with_tree();
+void quiz_case_pcj_simplification_basic();
+void quiz_case_pcj_simplification_big_nary();
+void quiz_case_pcj_simplification_derivative();
+void quiz_case_pcj_simplification_matrix();
+void quiz_case_pcj_simplification_complex();
+void quiz_case_pcj_simplification_polar();
+void quiz_case_pcj_simplification_parametric();
+void quiz_case_pcj_simplification_factorial();
+void quiz_case_pcj_simplification_hyperbolic_trigonometry();
+void quiz_case_pcj_simplification_advanced_trigonometry();
+void quiz_case_pcj_simplification_arithmetic();
+void quiz_case_pcj_simplification_percent();
+void quiz_case_pcj_simplification_list_bubble_up();
+void quiz_case_pcj_simplification_list();
+void quiz_case_pcj_simplification_random();
+void quiz_case_pcj_simplification_power();
+void quiz_case_pcj_simplification_float();
+void quiz_case_pcj_simplification_constants();
+void quiz_case_pcj_simplification_unit();
+void quiz_case_pcj_simplification_dependencies();
+void quiz_case_pcj_simplification_infinity();
+void quiz_case_pcj_simplification_trigonometry();
+void quiz_case_pcj_simplification_advanced();
+void quiz_case_pcj_simplification_logarithm();
+void quiz_case_pcj_simplification_large_integer_no_crash();
+void quiz_case_pcj_simplification_large_numbers();
+void quiz_case_pcj_simplification_boolean();
+void quiz_case_pcj_simplification_point();
+void quiz_case_pcj_simplification_piecewise();
+void quiz_case_pcj_simplification_distributions();
+void quiz_case_pcj_simplification_function();
+void quiz_case_pcj_simplification_variable_replace();
+void quiz_case_pcj_simplification_decimal();
+void quiz_case_pcj_simplification_rational_power();
+void quiz_case_pcj_euclidean_division();
+void quiz_case_pcj_simplification_integral();
+void quiz_case_pcj_simplification_roots();
+void quiz_case_pcj_simplification_undef();
+void quiz_case_pcj_simplification_for_approximation_and_analysis();
+void quiz_case_pcj_statistics_dataset_order();
+void quiz_case_pcj_statistics_dataset_large_columns();
+void quiz_case_pcj_tree_stack();
+void quiz_case_pcj_tree_ref();
+void quiz_case_pcj_tree_ref_reallocation();
+void quiz_case_pcj_tree_ref_destructor();
+void quiz_case_pcj_tree_motions();
+void quiz_case_pcj_tree_stack_drop_blocks_from();
+void quiz_case_pcj_tree_stack_checkpoint_raise();
+void quiz_case_pcj_trigonometry_exact_formulas();
+void quiz_case_pcj_exact_and_approximate_are_equal();
+void quiz_case_python_basics();
+void quiz_case_python_built_in();
+void quiz_case_python_fixes();
+void quiz_case_python_ion_import();
+void quiz_case_python_ion_keydown();
+void quiz_case_python_kandinsky_import();
+void quiz_case_python_kandinsky_basics();
+void quiz_case_python_kandinsky_bulk();
+void quiz_case_python_math();
+void quiz_case_python_cmath();
+void quiz_case_python_matplotlib_pyplot_import();
+void quiz_case_python_matplotlib_pyplot_arrow();
+void quiz_case_python_matplotlib_pyplot_axis();
+void quiz_case_python_matplotlib_pyplot_bar();
+void quiz_case_python_matplotlib_pyplot_grid();
+void quiz_case_python_matplotlib_pyplot_hist();
+void quiz_case_python_matplotlib_pyplot_plot();
+void quiz_case_python_matplotlib_pyplot_scatter();
+void quiz_case_python_matplotlib_pyplot_text();
+void quiz_case_python_numpy();
+void quiz_case_python_random();
+void quiz_case_python_time();
+void quiz_case_python_turtle();
+void quiz_case_python_turtle_circle();
+void quiz_case_python_turtle_distance();
+
+QuizCase quiz_cases[] = {
+  quiz_case_shared_alignment_handling,
+  quiz_case_shared_curve_drawing_adaptive_step,
+  quiz_case_shared_interval_values,
+  quiz_case_calculation_store,
+  quiz_case_calculation_ans,
+  quiz_case_calculation_significant_digits,
+  quiz_case_calculation_display_exact_approximate,
+  quiz_case_calculation_big_expressions,
+  quiz_case_calculation_symbolic_computation,
+  quiz_case_calculation_symbolic_computation_and_parametered_expressions,
+  quiz_case_calculation_complex_format,
+  quiz_case_calculation_involving_sequence,
+  quiz_case_calculation_additional_results,
+  quiz_case_graph_caching,
+  quiz_case_graph_list_default_function_name,
+  quiz_case_graph_list_valid_function_name,
+  quiz_case_graph_cartesian_function_type,
+  quiz_case_graph_polar_line_type,
+  quiz_case_graph_function_properties,
+  quiz_case_graph_function_properties_with_predefined_variables,
+  quiz_case_code_clipboard_enters_and_exits_python,
+  quiz_case_code_variable_box,
+  quiz_case_code_template,
+  quiz_case_statistics,
+  quiz_case_statistics_multiple_series,
+  quiz_case_statistics_histograms,
+  quiz_case_distributions_results_binomial,
+  quiz_case_distributions_results_uniform,
+  quiz_case_distributions_results_exponential,
+  quiz_case_distributions_results_normal,
+  quiz_case_distributions_results_chi_squared,
+  quiz_case_distributions_results_student,
+  quiz_case_distributions_results_geometric,
+  quiz_case_distributions_results_hypergeometric,
+  quiz_case_distributions_results_poisson,
+  quiz_case_distributions_results_fisher,
+  quiz_case_distributions_parameters_binomial,
+  quiz_case_distributions_parameters_uniform,
+  quiz_case_distributions_parameters_exponential,
+  quiz_case_distributions_parameters_normal,
+  quiz_case_distributions_parameters_chi_squared,
+  quiz_case_distributions_parameters_student,
+  quiz_case_distributions_parameters_geometric,
+  quiz_case_distributions_parameters_hypergeometric,
+  quiz_case_distributions_parameters_poisson,
+  quiz_case_distributions_parameters_fisher,
+  quiz_case_inference_one_proportion_statistic,
+  quiz_case_inference_one_mean_t_statistic,
+  quiz_case_inference_one_mean_z_statistic,
+  quiz_case_inference_two_proportions_statistic,
+  quiz_case_inference_two_means_t_statistic,
+  quiz_case_inference_pooled_t_test,
+  quiz_case_inference_two_means_z_statistic,
+  quiz_case_inference_goodness_test,
+  quiz_case_inference_homogeneity_test,
+  quiz_case_inference_slope_t_statistic,
+  quiz_case_inference_one_mean_t_with_table,
+  quiz_case_solver_error,
+  quiz_case_solver_linear_system,
+  quiz_case_solver_quadratic,
+  quiz_case_solver_cubic,
+  quiz_case_solver_quadratic_real,
+  quiz_case_solver_cubic_real,
+  quiz_case_solver_approximate,
+  quiz_case_solver_complex_real,
+  quiz_case_solver_complex_cartesian,
+  quiz_case_solver_complex_polar,
+  quiz_case_solver_symbolic_computation,
+  quiz_case_solver_solving_range,
+  quiz_case_sequence_evaluation,
+  quiz_case_sequence_context,
+  quiz_case_sequence_order,
+  quiz_case_sequence_evaluation_at_distant_ranks,
+  quiz_case_sequence_sum_evaluation,
+  quiz_case_sequence_suitable_for_cobweb,
+  quiz_case_regression_linear,
+  quiz_case_regression_linear_2,
+  quiz_case_regression_linear_3,
+  quiz_case_regression_proportional,
+  quiz_case_regression_proportional_2,
+  quiz_case_regression_proportional_3,
+  quiz_case_regression_proportional_4,
+  quiz_case_regression_proportional_5,
+  quiz_case_regression_quadratic,
+  quiz_case_regression_quadratic_2,
+  quiz_case_regression_cubic,
+  quiz_case_regression_cubic_2,
+  quiz_case_regression_cubic_3,
+  quiz_case_regression_quartic,
+  quiz_case_regression_logarithmic,
+  quiz_case_regression_exponential,
+  quiz_case_regression_exponential_2,
+  quiz_case_regression_exponential_3,
+  quiz_case_regression_exponential_4,
+  quiz_case_regression_exponential_5,
+  quiz_case_regression_exponential_abx,
+  quiz_case_regression_power,
+  quiz_case_regression_median_0,
+  quiz_case_regression_median_1,
+  quiz_case_regression_median_2,
+  quiz_case_regression_trigonometric_1,
+  quiz_case_regression_trigonometric_2,
+  quiz_case_regression_trigonometric_3,
+  quiz_case_regression_trigonometric_4,
+  quiz_case_regression_trigonometric_4_bis,
+  quiz_case_regression_trigonometric_5,
+  quiz_case_regression_trigonometric_6,
+  quiz_case_regression_trigonometric_7,
+  quiz_case_regression_trigonometric_8,
+  quiz_case_regression_logistic,
+  quiz_case_regression_column_calculation,
+  quiz_case_regression_constant_column_calculation,
+  quiz_case_regression_calculation,
+  quiz_case_finance_simple_interest,
+  quiz_case_finance_compound_interest,
+  quiz_case_escher_layout_field_select_left_right,
+  quiz_case_escher_layout_field_select_up_down,
+  quiz_case_escher_layout_field_unselect,
+  quiz_case_escher_layout_field_delete,
+  quiz_case_escher_dirty_region,
+  quiz_case_escher_view_redraw_distant_rects,
+  quiz_case_escher_view_scroll_pixels,
+  quiz_case_ion_crc32,
+  quiz_case_ion_events_from_keyboard,
+  quiz_case_ion_exam_bytes,
+  quiz_case_ion_exam_mode_uninitialized,
+  quiz_case_ion_exam_mode,
+  quiz_case_ion_keyboard,
+  quiz_case_ion_storage_records_crc32,
+  quiz_case_ion_storage_store_and_destroy_record,
+  quiz_case_ion_storage_put_record_twice,
+  quiz_case_ion_storage_invalid_renaming,
+  quiz_case_ion_storage_valid_renaming,
+  quiz_case_ion_storage_available_space_moving,
+  quiz_case_ion_storage_record_name_verifier,
+  quiz_case_ion_storage_disabled_records,
+  quiz_case_ion_storage_many_records,
+  quiz_case_ion_storage_benchmark_lookups,
+  quiz_case_ion_storage_records_with_extension_at_index,
+  quiz_case_kandinsky_color_rgb,
+  quiz_case_kandinsky_color_blend,
+  quiz_case_kandinsky_color_hsv,
+  quiz_case_kandinsky_font_index_for_code_point,
+  quiz_case_kandinsky_draw_string_benchmark,
+  quiz_case_kandinsky_rect_intersect,
+  quiz_case_kandinsky_rect_union,
+  quiz_case_kandinsky_rect_empty_union,
+  quiz_case_kandinsky_rect_difference,
+  quiz_case_omg_arithmetic_gcd,
+  quiz_case_omg_bit_helper,
+  quiz_case_omg_memory_insert_simple_swap,
+  quiz_case_omg_memory_rotate,
+  quiz_case_omg_print_integer,
+  quiz_case_omg_print_int_left,
+  quiz_case_omg_print_int_right,
+  quiz_case_omg_ring_buffer,
+  quiz_case_omg_signaling_nan,
+  quiz_case_ion_utf8_code_point_system_parentheses,
+  quiz_case_ion_utf8_decode_forward,
+  quiz_case_ion_utf8_decode_invalid_code_point,
+  quiz_case_ion_utf8_decode_backwards,
+  quiz_case_ion_utf8_decoder_next_glyph,
+  quiz_case_ion_utf8_decoder_previous_glyph,
+  quiz_case_ion_utf8_decoder_code_point,
+  quiz_case_ion_utf8_decoder_is_the_end_of_a_code_point,
+  quiz_case_ion_utf8_helper_count_occurrences,
+  quiz_case_ion_utf8_helper_code_point_search,
+  quiz_case_ion_utf8_helper_not_code_point_search,
+  quiz_case_ion_utf8_copy_and_remove_code_point,
+  quiz_case_ion_utf8_remove_code_point,
+  quiz_case_ion_utf8_move_string_from_index_by_number_of_char,
+  quiz_case_ion_utf8_try_and_replace_pattern_in_string_by_pattern,
+  quiz_case_ion_utf8_helper_copy_until_code_point,
+  quiz_case_ion_utf8_helper_previous_code_point_is,
+  quiz_case_ion_utf8_helper_code_point_is,
+  quiz_case_ion_utf8_helper_remove_previous_glyph,
+  quiz_case_ion_utf8_code_point_at_glyph_offset,
+  quiz_case_ion_utf8_glyph_offset_at_code_point,
+  quiz_case_ion_utf8_helper_string_codepoint_length,
+  quiz_case_ion_utf8_helper_string_glyph_length,
+  quiz_case_ion_utf8_helper_beginning_of_word,
+  quiz_case_ion_utf8_helper_end_of_word,
+  quiz_case_ion_utf8_helper_is_prefix,
+  quiz_case_poincare_additional_results_numerical_values,
+  quiz_case_poincare_additional_results_generalization,
+  quiz_case_poincare_approximation_decimal,
+  quiz_case_poincare_approximation_based_integer,
+  quiz_case_poincare_approximation_rational,
+  quiz_case_poincare_approximation_float,
+  quiz_case_poincare_approximation_infinity,
+  quiz_case_poincare_approximation_addition,
+  quiz_case_poincare_approximation_multiplication,
+  quiz_case_poincare_approximation_power,
+  quiz_case_poincare_approximation_subtraction,
+  quiz_case_poincare_approximation_constant,
+  quiz_case_poincare_approximation_division,
+  quiz_case_poincare_approximation_logarithm,
+  quiz_case_poincare_approximation_function,
+  quiz_case_poincare_approximation_unique_random,
+  quiz_case_poincare_approximation_integral,
+  quiz_case_poincare_approximation_trigonometry_functions,
+  quiz_case_poincare_approximation_matrix,
+  quiz_case_poincare_approximation_list,
+  quiz_case_poincare_approximation_list_sequence,
+  quiz_case_poincare_approximation_map_on_list,
+  quiz_case_poincare_approximation_probability,
+  quiz_case_poincare_approximation_complex_format,
+  quiz_case_poincare_approximation_mix,
+  quiz_case_poincare_approximation_lists_access,
+  quiz_case_poincare_approximation_lists_functions,
+  quiz_case_poincare_approximation_mixed_fraction,
+  quiz_case_poincare_approximation_floor_ceil_integer,
+  quiz_case_poincare_approximation_booleans,
+  quiz_case_poincare_approximation_comparison_operators,
+  quiz_case_poincare_approximation_piecewise_operator,
+  quiz_case_poincare_approximation_point,
+  quiz_case_poincare_approximation_keeping_symbols,
+  quiz_case_poincare_arithmetic_gcd,
+  quiz_case_poincare_arithmetic_lcm,
+  quiz_case_poincare_arithmetic_factorization,
+  quiz_case_poincare_arithmetic_divisors,
+  quiz_case_poincare_conics_cartesian_canonic,
+  quiz_case_poincare_conics_cartesian_invalid,
+  quiz_case_poincare_conics_cartesian_general,
+  quiz_case_poincare_conics_cartesian_reduction,
+  quiz_case_poincare_conics_polar_shape,
+  quiz_case_poincare_conics_parametric_shape,
+  quiz_case_poincare_no_dependency,
+  quiz_case_poincare_dependency_function,
+  quiz_case_poincare_dependency_derivative,
+  quiz_case_poincare_dependency_parametered_expression,
+  quiz_case_poincare_dependency_sequence,
+  quiz_case_poincare_dependency_power,
+  quiz_case_poincare_dependency_multiplication,
+  quiz_case_poincare_dependency_trigonometry,
+  quiz_case_poincare_derivative_formal,
+  quiz_case_poincare_derivative_formal_higher_order,
+  quiz_case_poincare_derivative_reduced_approximation,
+  quiz_case_poincare_derivative_approximation,
+  quiz_case_poincare_derivative_approximation_higher_order,
+  quiz_case_poincare_student_distribution,
+  quiz_case_poincare_chi2_distribution,
+  quiz_case_poincare_normal_distribution_find_parameters,
+  quiz_case_poincare_distribution_infinity,
+  quiz_case_poincare_erf_inv,
+  quiz_case_poincare_exam_modes,
+  quiz_case_poincare_expression_order_constant,
+  quiz_case_poincare_expression_order_decimal,
+  quiz_case_poincare_expression_order_rational,
+  quiz_case_poincare_expression_order_float,
+  quiz_case_poincare_expression_order_power,
+  quiz_case_poincare_expression_order_symbol,
+  quiz_case_poincare_expression_order_function,
+  quiz_case_poincare_expression_order_mix,
+  quiz_case_poincare_expression_order_addition_multiplication,
+  quiz_case_poincare_properties_is_number,
+  quiz_case_poincare_properties_is_rational_number,
+  quiz_case_poincare_properties_has_random,
+  quiz_case_poincare_properties_is_parametered_expression,
+  quiz_case_poincare_properties_has_approximate,
+  quiz_case_poincare_properties_has_matrix,
+  quiz_case_poincare_properties_is_infinity,
+  quiz_case_poincare_properties_get_variables,
+  quiz_case_poincare_properties_get_polynomial_coefficients,
+  quiz_case_poincare_properties_children_list_length,
+  quiz_case_poincare_properties_list_of_points,
+  quiz_case_poincare_properties_is_continuous,
+  quiz_case_poincare_properties_deep_is_symbolic,
+  quiz_case_poincare_serialization_based_integer,
+  quiz_case_poincare_serialization_rational,
+  quiz_case_poincare_serialization_decimal,
+  quiz_case_poincare_serialization_float,
+  quiz_case_poincare_serialization_division,
+  quiz_case_poincare_serialization_factorial,
+  quiz_case_poincare_serialization_percent,
+  quiz_case_poincare_serialization_power,
+  quiz_case_poincare_serialization_derivative,
+  quiz_case_poincare_expression_to_layout,
+  quiz_case_poincare_expression_to_layout_multiplication_operator,
+  quiz_case_poincare_expression_to_layout_implicit_addition,
+  quiz_case_poincare_expression_to_layout_serializes_to_self,
+  quiz_case_poincare_expression_to_layout_mixed_fraction,
+  quiz_case_poincare_layout_constructors,
+  quiz_case_poincare_layout_comparison,
+  quiz_case_poincare_layout_serialization,
+  quiz_case_poincare_layout_to_expression_unparsable,
+  quiz_case_poincare_layout_to_expression_parsable,
+  quiz_case_poincare_matrix_rank,
+  quiz_case_poincare_matrix_undef,
+  quiz_case_poincare_solver_roots,
+  quiz_case_poincare_solver_minima,
+  quiz_case_poincare_solver_maxima,
+  quiz_case_poincare_solver_intersections,
+  quiz_case_poincare_parsing_tokenize_numbers,
+  quiz_case_poincare_parsing_memory_exhaustion,
+  quiz_case_poincare_parsing_parse_numbers,
+  quiz_case_poincare_parsing_parse,
+  quiz_case_poincare_parsing_matrices,
+  quiz_case_poincare_parsing_lists,
+  quiz_case_poincare_parsing_lists_access,
+  quiz_case_poincare_parsing_constants,
+  quiz_case_poincare_parsing_units,
+  quiz_case_poincare_parsing_identifiers,
+  quiz_case_poincare_parsing_derivative_apostrophe,
+  quiz_case_poincare_parsing_parse_store,
+  quiz_case_poincare_parsing_parse_unit_convert,
+  quiz_case_poincare_parsing_implicit_multiplication,
+  quiz_case_poincare_parsing_with_missing_parentheses,
+  quiz_case_poincare_parsing_mixed_fraction,
+  quiz_case_poincare_parsing_function_assignment,
+  quiz_case_poincare_parsing_east_arrows,
+  quiz_case_poincare_parsing_logic,
+  quiz_case_poincare_parsing_points,
+  quiz_case_poincare_print_custom_print,
+  quiz_case_poincare_print_float,
+  quiz_case_poincare_range_1d_validity,
+  quiz_case_poincare_range_1d_geometry,
+  quiz_case_poincare_range_1d_make_valid,
+  quiz_case_poincare_range_1d_set_bound,
+  quiz_case_poincare_range_1d_extend,
+  quiz_case_poincare_range_1d_zoom,
+  quiz_case_poincare_rational_order,
+  quiz_case_poincare_rational_addition,
+  quiz_case_poincare_rational_power,
+  quiz_case_poincare_regularized_incomplete_beta_function,
+  quiz_case_poincare_regularized_gamma,
+  quiz_case_poincare_simplification_based_integer,
+  quiz_case_poincare_simplification_decimal,
+  quiz_case_poincare_simplification_rational,
+  quiz_case_poincare_simplification_infinity,
+  quiz_case_poincare_simplification_addition,
+  quiz_case_poincare_simplification_multiplication,
+  quiz_case_poincare_simplification_units,
+  quiz_case_poincare_simplification_power,
+  quiz_case_poincare_simplification_factorial,
+  quiz_case_poincare_simplification_percent,
+  quiz_case_poincare_simplification_logarithm,
+  quiz_case_poincare_simplification_random,
+  quiz_case_poincare_simplification_randint,
+  quiz_case_poincare_simplification_function,
+  quiz_case_poincare_simplification_trigonometry_functions,
+  quiz_case_poincare_simplification_matrix,
+  quiz_case_poincare_simplification_functions_of_matrices,
+  quiz_case_poincare_simplification_store,
+  quiz_case_poincare_simplification_store_matrix,
+  quiz_case_poincare_simplification_store_correctly_parsed,
+  quiz_case_poincare_simplification_unit_convert,
+  quiz_case_poincare_simplification_complex_format,
+  quiz_case_poincare_simplification_reduction_target,
+  quiz_case_poincare_simplification_user_function,
+  quiz_case_poincare_simplification_mix,
+  quiz_case_poincare_hyperbolic_trigonometry,
+  quiz_case_poincare_advanced_trigonometry,
+  quiz_case_poincare_probability,
+  quiz_case_poincare_simplification_system_circuit_breaker_handled,
+  quiz_case_poincare_simplification_list,
+  quiz_case_poincare_simplification_functions_of_lists,
+  quiz_case_poincare_simplification_mix_lists,
+  quiz_case_poincare_simplification_mixed_fraction,
+  quiz_case_poincare_simplification_booleans,
+  quiz_case_poincare_simplification_comparison_operators,
+  quiz_case_poincare_simplification_logical_operators,
+  quiz_case_poincare_simplification_piecewise_operator,
+  quiz_case_poincare_simplification_integral,
+  quiz_case_poincare_simplification_point,
+  quiz_case_poincare_pool_handle_are_discared_after_block,
+  quiz_case_poincare_pool_handle_are_discared_after_function_call,
+  quiz_case_poincare_pool_handle_can_be_copied,
+  quiz_case_poincare_pool_handle_can_be_moved,
+  quiz_case_poincare_pool_object_release,
+  quiz_case_poincare_pool_handle_can_be_returned,
+  quiz_case_poincare_pool_handle_memory_failure,
+  quiz_case_poincare_pool_handle_does_not_copy,
+  quiz_case_poincare_pool_expression_can_start_uninitialized,
+  quiz_case_poincare_pool_expression_can_be_copied_even_if_uninitialized,
+  quiz_case_poincare_zoom_fit_points_of_interest,
+  quiz_case_poincare_zoom_fit_intersections,
+  quiz_case_poincare_zoom_sanitation,
+  quiz_case_pcj_approximation_can_approximate,
+  quiz_case_pcj_approximation_scalar,
+  quiz_case_pcj_approximation_boolean,
+  quiz_case_pcj_approximation_replace,
+  quiz_case_pcj_approximation_power,
+  quiz_case_pcj_approximation_list,
+  quiz_case_pcj_approximation_matrix,
+  quiz_case_pcj_approximation_infinity,
+  quiz_case_pcj_approximation_units,
+  quiz_case_pcj_approximation_trigonometry,
+  quiz_case_pcj_approximation_arithmetic,
+  quiz_case_pcj_approximation_parametrics,
+  quiz_case_pcj_approximation_integrals,
+  quiz_case_pcj_approximation_derivatives,
+  quiz_case_pcj_approximation_percent,
+  quiz_case_pcj_approximation_decimal,
+  quiz_case_pcj_approximation_with_context,
+  quiz_case_pcj_prepare_function,
+  quiz_case_pcj_prepare_expression,
+  quiz_case_pcj_approximation_program,
+  quiz_case_pcj_approximation_program_benchmark,
+  quiz_case_pcj_beautification,
+  quiz_case_pcj_beautification_complex,
+  quiz_case_pcj_bounds_sign,
+  quiz_case_pcj_dimension,
+  quiz_case_pcj_equation_solver,
+  quiz_case_pcj_equation_solver_auto_range,
+  quiz_case_pcj_integer_constructor,
+  quiz_case_pcj_integer_properties,
+  quiz_case_pcj_integer_compare,
+  quiz_case_pcj_integer_set_sign,
+  quiz_case_pcj_integer_addition,
+  quiz_case_pcj_integer_subtraction,
+  quiz_case_pcj_integer_multiplication,
+  quiz_case_pcj_integer_divide,
+  quiz_case_pcj_integer_pow,
+  quiz_case_pcj_integer_factorial,
+  quiz_case_pcj_integer_gcd,
+  quiz_case_pcj_integer_overflows,
+  quiz_case_pcj_integer_cast,
+  quiz_case_pcj_integer_serialize,
+  quiz_case_pcj_k_tree,
+  quiz_case_pcj_k_tree_integer,
+  quiz_case_pcj_k_tree_rational_ranges,
+  quiz_case_pcj_k_tree_ternary,
+  quiz_case_pcj_k_codepoints,
+  quiz_case_pcj_k_rack,
+  quiz_case_pcj_k_tree_to_tree_pointer,
+  quiz_case_pcj_k_tree_arbitrary_data,
+  quiz_case_pcj_latex_parser_latex_to_layout,
+  quiz_case_pcj_latex_parser_layout_to_latex,
+  quiz_case_pcj_expression_to_layout,
+  quiz_case_pcj_layout_decoder,
+  quiz_case_pcj_omg_code_point,
+  quiz_case_pcj_layout_multiplication_symbol,
+  quiz_case_pcj_k_matrix_l,
+  quiz_case_pcj_layout_serialization,
+  quiz_case_pcj_layout_rack_cache,
+  quiz_case_pcj_context,
+  quiz_case_pcj_match,
+  quiz_case_pcj_rewrite_replace,
+  quiz_case_pcj_match_n_ary,
+  quiz_case_pcj_matrix,
+  quiz_case_pcj_block,
+  quiz_case_pcj_type_block,
+  quiz_case_pcj_constexpr_tree_constructor,
+  quiz_case_pcj_edition_node_constructor,
+  quiz_case_pcj_node_iterator,
+  quiz_case_pcj_node,
+  quiz_case_pcj_node_size,
+  quiz_case_pcj_tree_ancestors,
+  quiz_case_pcj_constructor,
+  quiz_case_pcj_pushers,
+  quiz_case_pcj_n_ary_manipulation,
+  quiz_case_pcj_order,
+  quiz_case_pcj_sort,
+  quiz_case_pcj_subtree,
+  quiz_case_pcj_parse_layout_tokenize,
+  quiz_case_pcj_parse_layout,
+  quiz_case_pcj_parse_unit,
+  quiz_case_pcj_parse_assignment,
+  quiz_case_pcj_parse_mixed_fraction,
+  quiz_case_pcj_parse_parametric,
+  quiz_case_pcj_parse_sequences,
+  quiz_case_pcj_polynomial_operations,
+  quiz_case_pcj_polynomial_degree,
+  quiz_case_pcj_projection,
+  quiz_case_pcj_random_seeds,
+  quiz_case_pcj_random_range_values,
+  quiz_case_pcj_rational_properties,
+  quiz_case_pcj_rational_set_sign,
+  quiz_case_pcj_rational_sign_of_ln,
+  quiz_case_pcj_rational_irreducible_form,
+  quiz_case_pcj_rational_addition,
+  quiz_case_pcj_rational_multiplication,
+  quiz_case_pcj_rational_integer_power,
+  quiz_case_pcj_rational_create_mixed_fraction,
+  quiz_case_pcj_roots,
+  quiz_case_pcj_expression_serialization,
+  quiz_case_pcj_expression_or_float_serialization,
+  quiz_case_pcj_set,
+  quiz_case_pcj_sign_methods,
+  quiz_case_pcj_sign,
+  quiz_case_pcj_sign_is_zero,
+  quiz_case_pcj_sign_is_positive,
+  quiz_case_pcj_sign_reduced_is_positive,
+  quiz_case_pcj_sign_set,
+  quiz_case_pcj_sign_is_real,
+  quiz_case_pcj_simplification_expansion,
+  quiz_case_pcj_simplification_algebraic_expansion,
+  quiz_case_pcj_simplification_contraction,
+  quiz_case_pcj_simplification_variables,
+  quiz_case_pcj_replace_symbol_with_tree,
+  quiz_case_pcj_simplification_basic,
+  quiz_case_pcj_simplification_big_nary,
+  quiz_case_pcj_simplification_derivative,
+  quiz_case_pcj_simplification_matrix,
+  quiz_case_pcj_simplification_complex,
+  quiz_case_pcj_simplification_polar,
+  quiz_case_pcj_simplification_parametric,
+  quiz_case_pcj_simplification_factorial,
+  quiz_case_pcj_simplification_hyperbolic_trigonometry,
+  quiz_case_pcj_simplification_advanced_trigonometry,
+  quiz_case_pcj_simplification_arithmetic,
+  quiz_case_pcj_simplification_percent,
+  quiz_case_pcj_simplification_list_bubble_up,
+  quiz_case_pcj_simplification_list,
+  quiz_case_pcj_simplification_random,
+  quiz_case_pcj_simplification_power,
+  quiz_case_pcj_simplification_float,
+  quiz_case_pcj_simplification_constants,
+  quiz_case_pcj_simplification_unit,
+  quiz_case_pcj_simplification_dependencies,
+  quiz_case_pcj_simplification_infinity,
+  quiz_case_pcj_simplification_trigonometry,
+  quiz_case_pcj_simplification_advanced,
+  quiz_case_pcj_simplification_logarithm,
+  quiz_case_pcj_simplification_large_integer_no_crash,
+  quiz_case_pcj_simplification_large_numbers,
+  quiz_case_pcj_simplification_boolean,
+  quiz_case_pcj_simplification_point,
+  quiz_case_pcj_simplification_piecewise,
+  quiz_case_pcj_simplification_distributions,
+  quiz_case_pcj_simplification_function,
+  quiz_case_pcj_simplification_variable_replace,
+  quiz_case_pcj_simplification_decimal,
+  quiz_case_pcj_simplification_rational_power,
+  quiz_case_pcj_euclidean_division,
+  quiz_case_pcj_simplification_integral,
+  quiz_case_pcj_simplification_roots,
+  quiz_case_pcj_simplification_undef,
+  quiz_case_pcj_simplification_for_approximation_and_analysis,
+  quiz_case_pcj_statistics_dataset_order,
+  quiz_case_pcj_statistics_dataset_large_columns,
+  quiz_case_pcj_tree_stack,
+  quiz_case_pcj_tree_ref,
+  quiz_case_pcj_tree_ref_reallocation,
+  quiz_case_pcj_tree_ref_destructor,
+  quiz_case_pcj_tree_motions,
+  quiz_case_pcj_tree_stack_drop_blocks_from,
+  quiz_case_pcj_tree_stack_checkpoint_raise,
+  quiz_case_pcj_trigonometry_exact_formulas,
+  quiz_case_pcj_exact_and_approximate_are_equal,
+  quiz_case_python_basics,
+  quiz_case_python_built_in,
+  quiz_case_python_fixes,
+  quiz_case_python_ion_import,
+  quiz_case_python_ion_keydown,
+  quiz_case_python_kandinsky_import,
+  quiz_case_python_kandinsky_basics,
+  quiz_case_python_kandinsky_bulk,
+  quiz_case_python_math,
+  quiz_case_python_cmath,
+  quiz_case_python_matplotlib_pyplot_import,
+  quiz_case_python_matplotlib_pyplot_arrow,
+  quiz_case_python_matplotlib_pyplot_axis,
+  quiz_case_python_matplotlib_pyplot_bar,
+  quiz_case_python_matplotlib_pyplot_grid,
+  quiz_case_python_matplotlib_pyplot_hist,
+  quiz_case_python_matplotlib_pyplot_plot,
+  quiz_case_python_matplotlib_pyplot_scatter,
+  quiz_case_python_matplotlib_pyplot_text,
+  quiz_case_python_numpy,
+  quiz_case_python_random,
+  quiz_case_python_time,
+  quiz_case_python_turtle,
+  quiz_case_python_turtle_circle,
+  quiz_case_python_turtle_distance,
+  NULL
+};
+
+char * quiz_case_names[] = {
+  "shared_alignment_handling",
+  "shared_curve_drawing_adaptive_step",
+  "shared_interval_values",
+  "calculation_store",
+  "calculation_ans",
+  "calculation_significant_digits",
+  "calculation_display_exact_approximate",
+  "calculation_big_expressions",
+  "calculation_symbolic_computation",
+  "calculation_symbolic_computation_and_parametered_expressions",
+  "calculation_complex_format",
+  "calculation_involving_sequence",
+  "calculation_additional_results",
+  "graph_caching",
+  "graph_list_default_function_name",
+  "graph_list_valid_function_name",
+  "graph_cartesian_function_type",
+  "graph_polar_line_type",
+  "graph_function_properties",
+  "graph_function_properties_with_predefined_variables",
+  "code_clipboard_enters_and_exits_python",
+  "code_variable_box",
+  "code_template",
+  "statistics",
+  "statistics_multiple_series",
+  "statistics_histograms",
+  "distributions_results_binomial",
+  "distributions_results_uniform",
+  "distributions_results_exponential",
+  "distributions_results_normal",
+  "distributions_results_chi_squared",
+  "distributions_results_student",
+  "distributions_results_geometric",
+  "distributions_results_hypergeometric",
+  "distributions_results_poisson",
+  "distributions_results_fisher",
+  "distributions_parameters_binomial",
+  "distributions_parameters_uniform",
+  "distributions_parameters_exponential",
+  "distributions_parameters_normal",
+  "distributions_parameters_chi_squared",
+  "distributions_parameters_student",
+  "distributions_parameters_geometric",
+  "distributions_parameters_hypergeometric",
+  "distributions_parameters_poisson",
+  "distributions_parameters_fisher",
+  "inference_one_proportion_statistic",
+  "inference_one_mean_t_statistic",
+  "inference_one_mean_z_statistic",
+  "inference_two_proportions_statistic",
+  "inference_two_means_t_statistic",
+  "inference_pooled_t_test",
+  "inference_two_means_z_statistic",
+  "inference_goodness_test",
+  "inference_homogeneity_test",
+  "inference_slope_t_statistic",
+  "inference_one_mean_t_with_table",
+  "solver_error",
+  "solver_linear_system",
+  "solver_quadratic",
+  "solver_cubic",
+  "solver_quadratic_real",
+  "solver_cubic_real",
+  "solver_approximate",
+  "solver_complex_real",
+  "solver_complex_cartesian",
+  "solver_complex_polar",
+  "solver_symbolic_computation",
+  "solver_solving_range",
+  "sequence_evaluation",
+  "sequence_context",
+  "sequence_order",
+  "sequence_evaluation_at_distant_ranks",
+  "sequence_sum_evaluation",
+  "sequence_suitable_for_cobweb",
+  "regression_linear",
+  "regression_linear_2",
+  "regression_linear_3",
+  "regression_proportional",
+  "regression_proportional_2",
+  "regression_proportional_3",
+  "regression_proportional_4",
+  "regression_proportional_5",
+  "regression_quadratic",
+  "regression_quadratic_2",
+  "regression_cubic",
+  "regression_cubic_2",
+  "regression_cubic_3",
+  "regression_quartic",
+  "regression_logarithmic",
+  "regression_exponential",
+  "regression_exponential_2",
+  "regression_exponential_3",
+  "regression_exponential_4",
+  "regression_exponential_5",
+  "regression_exponential_abx",
+  "regression_power",
+  "regression_median_0",
+  "regression_median_1",
+  "regression_median_2",
+  "regression_trigonometric_1",
+  "regression_trigonometric_2",
+  "regression_trigonometric_3",
+  "regression_trigonometric_4",
+  "regression_trigonometric_4_bis",
+  "regression_trigonometric_5",
+  "regression_trigonometric_6",
+  "regression_trigonometric_7",
+  "regression_trigonometric_8",
+  "regression_logistic",
+  "regression_column_calculation",
+  "regression_constant_column_calculation",
+  "regression_calculation",
+  "finance_simple_interest",
+  "finance_compound_interest",
+  "escher_layout_field_select_left_right",
+  "escher_layout_field_select_up_down",
+  "escher_layout_field_unselect",
+  "escher_layout_field_delete",
+  "escher_dirty_region",
+  "escher_view_redraw_distant_rects",
+  "escher_view_scroll_pixels",
+  "ion_crc32",
+  "ion_events_from_keyboard",
+  "ion_exam_bytes",
+  "ion_exam_mode_uninitialized",
+  "ion_exam_mode",
+  "ion_keyboard",
+  "ion_storage_records_crc32",
+  "ion_storage_store_and_destroy_record",
+  "ion_storage_put_record_twice",
+  "ion_storage_invalid_renaming",
+  "ion_storage_valid_renaming",
+  "ion_storage_available_space_moving",
+  "ion_storage_record_name_verifier",
+  "ion_storage_disabled_records",
+  "ion_storage_many_records",
+  "ion_storage_benchmark_lookups",
+  "ion_storage_records_with_extension_at_index",
+  "kandinsky_color_rgb",
+  "kandinsky_color_blend",
+  "kandinsky_color_hsv",
+  "kandinsky_font_index_for_code_point",
+  "kandinsky_draw_string_benchmark",
+  "kandinsky_rect_intersect",
+  "kandinsky_rect_union",
+  "kandinsky_rect_empty_union",
+  "kandinsky_rect_difference",
+  "omg_arithmetic_gcd",
+  "omg_bit_helper",
+  "omg_memory_insert_simple_swap",
+  "omg_memory_rotate",
+  "omg_print_integer",
+  "omg_print_int_left",
+  "omg_print_int_right",
+  "omg_ring_buffer",
+  "omg_signaling_nan",
+  "ion_utf8_code_point_system_parentheses",
+  "ion_utf8_decode_forward",
+  "ion_utf8_decode_invalid_code_point",
+  "ion_utf8_decode_backwards",
+  "ion_utf8_decoder_next_glyph",
+  "ion_utf8_decoder_previous_glyph",
+  "ion_utf8_decoder_code_point",
+  "ion_utf8_decoder_is_the_end_of_a_code_point",
+  "ion_utf8_helper_count_occurrences",
+  "ion_utf8_helper_code_point_search",
+  "ion_utf8_helper_not_code_point_search",
+  "ion_utf8_copy_and_remove_code_point",
+  "ion_utf8_remove_code_point",
+  "ion_utf8_move_string_from_index_by_number_of_char",
+  "ion_utf8_try_and_replace_pattern_in_string_by_pattern",
+  "ion_utf8_helper_copy_until_code_point",
+  "ion_utf8_helper_previous_code_point_is",
+  "ion_utf8_helper_code_point_is",
+  "ion_utf8_helper_remove_previous_glyph",
+  "ion_utf8_code_point_at_glyph_offset",
+  "ion_utf8_glyph_offset_at_code_point",
+  "ion_utf8_helper_string_codepoint_length",
+  "ion_utf8_helper_string_glyph_length",
+  "ion_utf8_helper_beginning_of_word",
+  "ion_utf8_helper_end_of_word",
+  "ion_utf8_helper_is_prefix",
+  "poincare_additional_results_numerical_values",
+  "poincare_additional_results_generalization",
+  "poincare_approximation_decimal",
+  "poincare_approximation_based_integer",
+  "poincare_approximation_rational",
+  "poincare_approximation_float",
+  "poincare_approximation_infinity",
+  "poincare_approximation_addition",
+  "poincare_approximation_multiplication",
+  "poincare_approximation_power",
+  "poincare_approximation_subtraction",
+  "poincare_approximation_constant",
+  "poincare_approximation_division",
+  "poincare_approximation_logarithm",
+  "poincare_approximation_function",
+  "poincare_approximation_unique_random",
+  "poincare_approximation_integral",
+  "poincare_approximation_trigonometry_functions",
+  "poincare_approximation_matrix",
+  "poincare_approximation_list",
+  "poincare_approximation_list_sequence",
+  "poincare_approximation_map_on_list",
+  "poincare_approximation_probability",
+  "poincare_approximation_complex_format",
+  "poincare_approximation_mix",
+  "poincare_approximation_lists_access",
+  "poincare_approximation_lists_functions",
+  "poincare_approximation_mixed_fraction",
+  "poincare_approximation_floor_ceil_integer",
+  "poincare_approximation_booleans",
+  "poincare_approximation_comparison_operators",
+  "poincare_approximation_piecewise_operator",
+  "poincare_approximation_point",
+  "poincare_approximation_keeping_symbols",
+  "poincare_arithmetic_gcd",
+  "poincare_arithmetic_lcm",
+  "poincare_arithmetic_factorization",
+  "poincare_arithmetic_divisors",
+  "poincare_conics_cartesian_canonic",
+  "poincare_conics_cartesian_invalid",
+  "poincare_conics_cartesian_general",
+  "poincare_conics_cartesian_reduction",
+  "poincare_conics_polar_shape",
+  "poincare_conics_parametric_shape",
+  "poincare_no_dependency",
+  "poincare_dependency_function",
+  "poincare_dependency_derivative",
+  "poincare_dependency_parametered_expression",
+  "poincare_dependency_sequence",
+  "poincare_dependency_power",
+  "poincare_dependency_multiplication",
+  "poincare_dependency_trigonometry",
+  "poincare_derivative_formal",
+  "poincare_derivative_formal_higher_order",
+  "poincare_derivative_reduced_approximation",
+  "poincare_derivative_approximation",
+  "poincare_derivative_approximation_higher_order",
+  "poincare_student_distribution",
+  "poincare_chi2_distribution",
+  "poincare_normal_distribution_find_parameters",
+  "poincare_distribution_infinity",
+  "poincare_erf_inv",
+  "poincare_exam_modes",
+  "poincare_expression_order_constant",
+  "poincare_expression_order_decimal",
+  "poincare_expression_order_rational",
+  "poincare_expression_order_float",
+  "poincare_expression_order_power",
+  "poincare_expression_order_symbol",
+  "poincare_expression_order_function",
+  "poincare_expression_order_mix",
+  "poincare_expression_order_addition_multiplication",
+  "poincare_properties_is_number",
+  "poincare_properties_is_rational_number",
+  "poincare_properties_has_random",
+  "poincare_properties_is_parametered_expression",
+  "poincare_properties_has_approximate",
+  "poincare_properties_has_matrix",
+  "poincare_properties_is_infinity",
+  "poincare_properties_get_variables",
+  "poincare_properties_get_polynomial_coefficients",
+  "poincare_properties_children_list_length",
+  "poincare_properties_list_of_points",
+  "poincare_properties_is_continuous",
+  "poincare_properties_deep_is_symbolic",
+  "poincare_serialization_based_integer",
+  "poincare_serialization_rational",
+  "poincare_serialization_decimal",
+  "poincare_serialization_float",
+  "poincare_serialization_division",
+  "poincare_serialization_factorial",
+  "poincare_serialization_percent",
+  "poincare_serialization_power",
+  "poincare_serialization_derivative",
+  "poincare_expression_to_layout",
+  "poincare_expression_to_layout_multiplication_operator",
+  "poincare_expression_to_layout_implicit_addition",
+  "poincare_expression_to_layout_serializes_to_self",
+  "poincare_expression_to_layout_mixed_fraction",
+  "poincare_layout_constructors",
+  "poincare_layout_comparison",
+  "poincare_layout_serialization",
+  "poincare_layout_to_expression_unparsable",
+  "poincare_layout_to_expression_parsable",
+  "poincare_matrix_rank",
+  "poincare_matrix_undef",
+  "poincare_solver_roots",
+  "poincare_solver_minima",
+  "poincare_solver_maxima",
+  "poincare_solver_intersections",
+  "poincare_parsing_tokenize_numbers",
+  "poincare_parsing_memory_exhaustion",
+  "poincare_parsing_parse_numbers",
+  "poincare_parsing_parse",
+  "poincare_parsing_matrices",
+  "poincare_parsing_lists",
+  "poincare_parsing_lists_access",
+  "poincare_parsing_constants",
+  "poincare_parsing_units",
+  "poincare_parsing_identifiers",
+  "poincare_parsing_derivative_apostrophe",
+  "poincare_parsing_parse_store",
+  "poincare_parsing_parse_unit_convert",
+  "poincare_parsing_implicit_multiplication",
+  "poincare_parsing_with_missing_parentheses",
+  "poincare_parsing_mixed_fraction",
+  "poincare_parsing_function_assignment",
+  "poincare_parsing_east_arrows",
+  "poincare_parsing_logic",
+  "poincare_parsing_points",
+  "poincare_print_custom_print",
+  "poincare_print_float",
+  "poincare_range_1d_validity",
+  "poincare_range_1d_geometry",
+  "poincare_range_1d_make_valid",
+  "poincare_range_1d_set_bound",
+  "poincare_range_1d_extend",
+  "poincare_range_1d_zoom",
+  "poincare_rational_order",
+  "poincare_rational_addition",
+  "poincare_rational_power",
+  "poincare_regularized_incomplete_beta_function",
+  "poincare_regularized_gamma",
+  "poincare_simplification_based_integer",
+  "poincare_simplification_decimal",
+  "poincare_simplification_rational",
+  "poincare_simplification_infinity",
+  "poincare_simplification_addition",
+  "poincare_simplification_multiplication",
+  "poincare_simplification_units",
+  "poincare_simplification_power",
+  "poincare_simplification_factorial",
+  "poincare_simplification_percent",
+  "poincare_simplification_logarithm",
+  "poincare_simplification_random",
+  "poincare_simplification_randint",
+  "poincare_simplification_function",
+  "poincare_simplification_trigonometry_functions",
+  "poincare_simplification_matrix",
+  "poincare_simplification_functions_of_matrices",
+  "poincare_simplification_store",
+  "poincare_simplification_store_matrix",
+  "poincare_simplification_store_correctly_parsed",
+  "poincare_simplification_unit_convert",
+  "poincare_simplification_complex_format",
+  "poincare_simplification_reduction_target",
+  "poincare_simplification_user_function",
+  "poincare_simplification_mix",
+  "poincare_hyperbolic_trigonometry",
+  "poincare_advanced_trigonometry",
+  "poincare_probability",
+  "poincare_simplification_system_circuit_breaker_handled",
+  "poincare_simplification_list",
+  "poincare_simplification_functions_of_lists",
+  "poincare_simplification_mix_lists",
+  "poincare_simplification_mixed_fraction",
+  "poincare_simplification_booleans",
+  "poincare_simplification_comparison_operators",
+  "poincare_simplification_logical_operators",
+  "poincare_simplification_piecewise_operator",
+  "poincare_simplification_integral",
+  "poincare_simplification_point",
+  "poincare_pool_handle_are_discared_after_block",
+  "poincare_pool_handle_are_discared_after_function_call",
+  "poincare_pool_handle_can_be_copied",
+  "poincare_pool_handle_can_be_moved",
+  "poincare_pool_object_release",
+  "poincare_pool_handle_can_be_returned",
+  "poincare_pool_handle_memory_failure",
+  "poincare_pool_handle_does_not_copy",
+  "poincare_pool_expression_can_start_uninitialized",
+  "poincare_pool_expression_can_be_copied_even_if_uninitialized",
+  "poincare_zoom_fit_points_of_interest",
+  "poincare_zoom_fit_intersections",
+  "poincare_zoom_sanitation",
+  "pcj_approximation_can_approximate",
+  "pcj_approximation_scalar",
+  "pcj_approximation_boolean",
+  "pcj_approximation_replace",
+  "pcj_approximation_power",
+  "pcj_approximation_list",
+  "pcj_approximation_matrix",
+  "pcj_approximation_infinity",
+  "pcj_approximation_units",
+  "pcj_approximation_trigonometry",
+  "pcj_approximation_arithmetic",
+  "pcj_approximation_parametrics",
+  "pcj_approximation_integrals",
+  "pcj_approximation_derivatives",
+  "pcj_approximation_percent",
+  "pcj_approximation_decimal",
+  "pcj_approximation_with_context",
+  "pcj_prepare_function",
+  "pcj_prepare_expression",
+  "pcj_approximation_program",
+  "pcj_approximation_program_benchmark",
+  "pcj_beautification",
+  "pcj_beautification_complex",
+  "pcj_bounds_sign",
+  "pcj_dimension",
+  "pcj_equation_solver",
+  "pcj_equation_solver_auto_range",
+  "pcj_integer_constructor",
+  "pcj_integer_properties",
+  "pcj_integer_compare",
+  "pcj_integer_set_sign",
+  "pcj_integer_addition",
+  "pcj_integer_subtraction",
+  "pcj_integer_multiplication",
+  "pcj_integer_divide",
+  "pcj_integer_pow",
+  "pcj_integer_factorial",
+  "pcj_integer_gcd",
+  "pcj_integer_overflows",
+  "pcj_integer_cast",
+  "pcj_integer_serialize",
+  "pcj_k_tree",
+  "pcj_k_tree_integer",
+  "pcj_k_tree_rational_ranges",
+  "pcj_k_tree_ternary",
+  "pcj_k_codepoints",
+  "pcj_k_rack",
+  "pcj_k_tree_to_tree_pointer",
+  "pcj_k_tree_arbitrary_data",
+  "pcj_latex_parser_latex_to_layout",
+  "pcj_latex_parser_layout_to_latex",
+  "pcj_expression_to_layout",
+  "pcj_layout_decoder",
+  "pcj_omg_code_point",
+  "pcj_layout_multiplication_symbol",
+  "pcj_k_matrix_l",
+  "pcj_layout_serialization",
+  "pcj_layout_rack_cache",
+  "pcj_context",
+  "pcj_match",
+  "pcj_rewrite_replace",
+  "pcj_match_n_ary",
+  "pcj_matrix",
+  "pcj_block",
+  "pcj_type_block",
+  "pcj_constexpr_tree_constructor",
+  "pcj_edition_node_constructor",
+  "pcj_node_iterator",
+  "pcj_node",
+  "pcj_node_size",
+  "pcj_tree_ancestors",
+  "pcj_constructor",
+  "pcj_pushers",
+  "pcj_n_ary_manipulation",
+  "pcj_order",
+  "pcj_sort",
+  "pcj_subtree",
+  "pcj_parse_layout_tokenize",
+  "pcj_parse_layout",
+  "pcj_parse_unit",
+  "pcj_parse_assignment",
+  "pcj_parse_mixed_fraction",
+  "pcj_parse_parametric",
+  "pcj_parse_sequences",
+  "pcj_polynomial_operations",
+  "pcj_polynomial_degree",
+  "pcj_projection",
+  "pcj_random_seeds",
+  "pcj_random_range_values",
+  "pcj_rational_properties",
+  "pcj_rational_set_sign",
+  "pcj_rational_sign_of_ln",
+  "pcj_rational_irreducible_form",
+  "pcj_rational_addition",
+  "pcj_rational_multiplication",
+  "pcj_rational_integer_power",
+  "pcj_rational_create_mixed_fraction",
+  "pcj_roots",
+  "pcj_expression_serialization",
+  "pcj_expression_or_float_serialization",
+  "pcj_set",
+  "pcj_sign_methods",
+  "pcj_sign",
+  "pcj_sign_is_zero",
+  "pcj_sign_is_positive",
+  "pcj_sign_reduced_is_positive",
+  "pcj_sign_set",
+  "pcj_sign_is_real",
+  "pcj_simplification_expansion",
+  "pcj_simplification_algebraic_expansion",
+  "pcj_simplification_contraction",
+  "pcj_simplification_variables",
+  "pcj_replace_symbol_with_tree",
+  "pcj_simplification_basic",
+  "pcj_simplification_big_nary",
+  "pcj_simplification_derivative",
+  "pcj_simplification_matrix",
+  "pcj_simplification_complex",
+  "pcj_simplification_polar",
+  "pcj_simplification_parametric",
+  "pcj_simplification_factorial",
+  "pcj_simplification_hyperbolic_trigonometry",
+  "pcj_simplification_advanced_trigonometry",
+  "pcj_simplification_arithmetic",
+  "pcj_simplification_percent",
+  "pcj_simplification_list_bubble_up",
+  "pcj_simplification_list",
+  "pcj_simplification_random",
+  "pcj_simplification_power",
+  "pcj_simplification_float",
+  "pcj_simplification_constants",
+  "pcj_simplification_unit",
+  "pcj_simplification_dependencies",
+  "pcj_simplification_infinity",
+  "pcj_simplification_trigonometry",
+  "pcj_simplification_advanced",
+  "pcj_simplification_logarithm",
+  "pcj_simplification_large_integer_no_crash",
+  "pcj_simplification_large_numbers",
+  "pcj_simplification_boolean",
+  "pcj_simplification_point",
+  "pcj_simplification_piecewise",
+  "pcj_simplification_distributions",
+  "pcj_simplification_function",
+  "pcj_simplification_variable_replace",
+  "pcj_simplification_decimal",
+  "pcj_simplification_rational_power",
+  "pcj_euclidean_division",
+  "pcj_simplification_integral",
+  "pcj_simplification_roots",
+  "pcj_simplification_undef",
+  "pcj_simplification_for_approximation_and_analysis",
+  "pcj_statistics_dataset_order",
+  "pcj_statistics_dataset_large_columns",
+  "pcj_tree_stack",
+  "pcj_tree_ref",
+  "pcj_tree_ref_reallocation",
+  "pcj_tree_ref_destructor",
+  "pcj_tree_motions",
+  "pcj_tree_stack_drop_blocks_from",
+  "pcj_tree_stack_checkpoint_raise",
+  "pcj_trigonometry_exact_formulas",
+  "pcj_exact_and_approximate_are_equal",
+  "python_basics",
+  "python_built_in",
+  "python_fixes",
+  "python_ion_import",
+  "python_ion_keydown",
+  "python_kandinsky_import",
+  "python_kandinsky_basics",
+  "python_kandinsky_bulk",
+  "python_math",
+  "python_cmath",
+  "python_matplotlib_pyplot_import",
+  "python_matplotlib_pyplot_arrow",
+  "python_matplotlib_pyplot_axis",
+  "python_matplotlib_pyplot_bar",
+  "python_matplotlib_pyplot_grid",
+  "python_matplotlib_pyplot_hist",
+  "python_matplotlib_pyplot_plot",
+  "python_matplotlib_pyplot_scatter",
+  "python_matplotlib_pyplot_text",
+  "python_numpy",
+  "python_random",
+  "python_time",
+  "python_turtle",
+  "python_turtle_circle",
+  "python_turtle_distance",
+  NULL
+};
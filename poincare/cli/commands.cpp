@@ -6,8 +6,11 @@
 #include <poincare/src/expression/projection.h>
 #include <poincare/src/expression/simplification.h>
 #include <poincare/src/expression/systematic_reduction.h>
+#include <poincare/src/memory/pattern_matching.h>
 #include <poincare/src/memory/tree.h>
+#include <poincare/src/memory/tree_stack.h>
 
+#include <chrono>
 #include <iostream>
 
 #include "history_context.h"
@@ -87,14 +90,108 @@ void logCommand(const std::vector<std::string>& args) {
   }
 }
 
+/* timeit [simplify|approximate|layout] <expression>
+ * Run the operation and print its duration with some stack and reduction
+ * counters, like ipython's timeit. */
+void timeitCommand(const std::vector<std::string>& args) {
+  enum class Operation { Simplify, Approximate, Layout };
+  Operation operation = Operation::Simplify;
+  std::vector<std::string> expressionArgs = args;
+  if (args.size() == 2) {
+    if (std::string("simplify").starts_with(args[0])) {
+      operation = Operation::Simplify;
+    } else if (std::string("approximate").starts_with(args[0])) {
+      operation = Operation::Approximate;
+    } else if (std::string("layout").starts_with(args[0])) {
+      operation = Operation::Layout;
+    } else {
+      std::cerr << "Unknown operation " << args[0] << "\n";
+      return;
+    }
+    expressionArgs.erase(expressionArgs.begin());
+  }
+  UserExpression e = getExpression(expressionArgs);
+#if POINCARE_METRICS
+  Internal::Tree::nextNodeCount = 0;
+  Internal::PatternMatching::matchCount = 0;
+  Internal::AdvancedReduction::memoHitCount = 0;
+  Internal::AdvancedReduction::memoMissCount = 0;
+  Internal::SharedTreeStack->resetPeakSize();
+#endif
+  auto start = std::chrono::steady_clock::now();
+  switch (operation) {
+    case Operation::Simplify: {
+      bool reductionFailure = false;
+      ProjectionContext ctx = context();
+      e = e.cloneAndSimplify(ctx, &reductionFailure);
+      break;
+    }
+    case Operation::Approximate: {
+      Internal::ProjectionContext ctx = context();
+      Internal::Tree* p = e.tree()->cloneTree();
+      Internal::Simplification::ToSystem(p, &ctx);
+      Internal::Tree* a = Internal::Approximation::ToTree<double>(p, {});
+      p->removeTree();
+      e = Expression::Builder(a);
+      break;
+    }
+    case Operation::Layout:
+      e.createLayout(Preferences::PrintFloatMode::Decimal,
+                     Preferences::VeryLargeNumberOfSignificantDigits,
+                     &s_historyContext);
+      break;
+  }
+  auto end = std::chrono::steady_clock::now();
+  std::cout << "time:           "
+            << std::chrono::duration_cast<std::chrono::microseconds>(end -
+                                                                     start)
+                   .count()
+            << " us\n";
+#if POINCARE_METRICS
+  std::cout << "peak blocks:    " << Internal::SharedTreeStack->peakSize()
+            << "\n";
+  std::cout << "nextNode:       " << Internal::Tree::nextNodeCount << "\n";
+  std::cout << "pattern match:  " << Internal::PatternMatching::matchCount
+            << "\n";
+  std::cout << "memo hit/miss:  " << Internal::AdvancedReduction::memoHitCount
+            << "/" << Internal::AdvancedReduction::memoMissCount << "\n";
+#endif
+  if (operation != Operation::Layout) {
+    printExpression(e);
+  }
+}
+
+// Simplify an expression, logging each step of the advanced reduction
+void traceCommand(const std::vector<std::string>& args) {
+  Internal::AdvancedReduction::traceSteps = true;
+  simplifyCommand(args);
+  Internal::AdvancedReduction::traceSteps = false;
+}
+
+// Display pattern matching statistics since the last call
+void patternsCommand(const std::vector<std::string>& args) {
+#if POINCARE_PATTERN_MATCHING_STATS
+  Internal::PatternMatching::LogStatistics();
+  Internal::PatternMatching::ResetStatistics();
+#else
+  std::cerr << "Build with POINCARE_PATTERN_MATCHING_STATS=1 to collect "
+               "pattern matching statistics\n";
+#endif
+}
+
 void helpCommand(const std::vector<std::string>& args) {
   std::cout << "Available commands (you can use a prefix if unique)\n";
   std::cout << "  approximate     -- Approximate an expression\n";
   std::cout << "  expand          -- Expand an expression using DeepExpand\n";
   std::cout << "  help            -- List available commands\n";
   std::cout << "  log             -- Display a tree\n";
+  std::cout << "  patterns        -- Display pattern matching statistics\n";
   std::cout
       << "  simplify        -- Simplify an expression with a default context\n";
+  std::cout << "  timeit          -- Time simplify (default), approximate or "
+               "layout\n";
+  std::cout << "  trace           -- Simplify and log advanced reduction "
+               "steps\n";
 }
 
 // Command map
@@ -104,4 +201,7 @@ std::map<std::string, void (*)(const std::vector<std::string>&)> commands = {
     {"help", helpCommand},
     {"simplify", simplifyCommand},
     {"log", logCommand},
+    {"patterns", patternsCommand},
+    {"timeit", timeitCommand},
+    {"trace", traceCommand},
 };
@@ -38,6 +38,7 @@ $(addprefix expression/, \
   approximation_integral.cpp \
   approximation_matrix.cpp \
   approximation_prepare.cpp \
+  approximation_program.cpp \
   approximation_power.cpp \
   approximation_logarithm.cpp \
   approximation_trigonometry.cpp \
@@ -127,6 +128,7 @@ $(addprefix layout/, \
   parsing/latex_parser.cpp \
   parsing/rack_parser.cpp \
   parsing/tokenizer.cpp \
+  rack_cache.cpp \
   rack_from_text.cpp \
   rack_layout.cpp \
   rack_layout_decoder.cpp \
@@ -241,6 +243,7 @@ _sources_poincare_test := $(addprefix test/, \
   old/tree/tree_handle.cpp \
   old/zoom.cpp \
   approximation.cpp \
+  approximation_program.cpp \
   beautification.cpp \
   bounds.cpp \
   dimension.cpp \
@@ -266,6 +269,7 @@ _sources_poincare_test := $(addprefix test/, \
   set.cpp \
   sign.cpp \
   simplification.cpp \
+  statistics.cpp \
   tree_stack.cpp \
   trigonometry_exact_formulas.cpp \
 $(addprefix helpers/, \
@@ -295,6 +299,11 @@ ifneq ($(POINCARE_METRICS),0)
 SFLAGS_poincare += -DPOINCARE_METRICS=1
 endif
 
+POINCARE_PATTERN_MATCHING_STATS ?= 0
+ifneq ($(POINCARE_PATTERN_MATCHING_STATS),0)
+SFLAGS_poincare += -DPOINCARE_PATTERN_MATCHING_STATS=1
+endif
+
 POINCARE_TREE_LOG ?= 0
 ifeq ($(PLATFORM_TYPE),simulator)
 ifeq ($(DEBUG),1)
@@ -81,6 +81,13 @@ AdvancedReduction::Path AdvancedReduction::FindBestReduction(
   PrivateReduce(editedExpression, &ctx);
   editedExpression->removeTree();
 
+#if POINCARE_TREE_LOG
+  if (traceSteps) {
+    std::cout << "Best metric " << ctx.m_bestMetric << " with path";
+    ctx.m_bestPath.log();
+  }
+#endif
+
 #if VERBOSE_REDUCTION >= 1
   assert(s_indent == 0);
   std::cout << "Best path metric is: " << ctx.m_bestMetric << "\n";
@@ -242,6 +249,100 @@ void AdvancedReduction::CrcCollection::decreaseMaxDepth() {
 #endif
 }
 
+#if POINCARE_TREE_LOG
+bool AdvancedReduction::traceSteps = false;
+#endif
+
+#if POINCARE_METRICS
+uint32_t AdvancedReduction::memoHitCount = 0;
+uint32_t AdvancedReduction::memoMissCount = 0;
+#endif
+
+bool AdvancedReduction::OperationMemo::find(const Tree* e, uint32_t hash,
+                                            Direction direction,
+                                            const Tree** result) const {
+  for (size_t slot = IndexSlot(hash, direction); m_index[slot] != k_noEntry;
+       slot = (slot + 1) % k_indexSize) {
+    const Entry& entry = m_entries[m_index[slot]];
+    if (entry.hash == hash && entry.direction == direction &&
+        entry.isComplete &&
+        Tree::FromBlocks(m_blocks + entry.input)->treeIsIdenticalTo(e)) {
+#if POINCARE_METRICS
+      memoHitCount++;
+#endif
+      *result = entry.result == k_noResult
+                    ? nullptr
+                    : Tree::FromBlocks(m_blocks + entry.result);
+      return true;
+    }
+  }
+#if POINCARE_METRICS
+  memoMissCount++;
+#endif
+  return false;
+}
+
+void AdvancedReduction::OperationMemo::clear() {
+  m_numberOfEntries = 0;
+  m_numberOfBlocks = 0;
+  memset(m_index, k_noEntry, sizeof(m_index));
+}
+
+uint16_t AdvancedReduction::OperationMemo::store(const Tree* e) {
+  size_t size = e->treeSize();
+  if (m_numberOfBlocks + size > m_budget) {
+    return k_noResult;
+  }
+  uint16_t offset = m_numberOfBlocks;
+  memcpy(m_blocks + offset, e->block(), size * sizeof(Block));
+  m_numberOfBlocks += size;
+  return offset;
+}
+
+int AdvancedReduction::OperationMemo::prepare(const Tree* e, uint32_t hash,
+                                              Direction direction) {
+  size_t size = e->treeSize();
+  if (size > m_budget / k_maxTreeSizeDivider) {
+    // Large trees would flush the table and are seldom met again
+    return -1;
+  }
+  if (m_numberOfEntries == k_maxNumberOfEntries ||
+      m_numberOfBlocks + 2 * size > m_budget) {
+    // Keep room for the result
+    clear();
+  }
+  uint16_t input = store(e);
+  if (input == k_noResult) {
+    return -1;
+  }
+  m_entries[m_numberOfEntries] = {.hash = hash,
+                                  .input = input,
+                                  .result = k_noResult,
+                                  .direction = direction,
+                                  .isComplete = false};
+  size_t slot = IndexSlot(hash, direction);
+  while (m_index[slot] != k_noEntry) {
+    slot = (slot + 1) % k_indexSize;
+  }
+  m_index[slot] = m_numberOfEntries;
+  return m_numberOfEntries++;
+}
+
+void AdvancedReduction::OperationMemo::complete(int index,
+                                                const Tree* result) {
+  assert(0 <= index && index < m_numberOfEntries);
+  Entry& entry = m_entries[index];
+  if (result) {
+    uint16_t offset = store(result);
+    if (offset == k_noResult) {
+      // Result does not fit, the entry stays incomplete
+      return;
+    }
+    entry.result = offset;
+  }
+  entry.isComplete = true;
+}
+
 const Tree* NextNodeSkippingIgnoredTrees(const Tree* e) {
   assert(!AdvancedOperation::CanSkipTree(e));
   const Tree* next = e->nextNode();
@@ -277,12 +378,27 @@ bool AdvancedReduction::Direction::applyNextNode(const Tree** u,
   return true;
 }
 
-bool AdvancedReduction::Direction::applyContractOrExpand(Tree** u,
-                                                         Tree* root) const {
+bool AdvancedReduction::Direction::applyContractOrExpand(
+    Tree** u, Tree* root, OperationMemo* memo) const {
   assert(isContract() || isExpand());
   assert(!AdvancedOperation::CanSkipTree(*u));
 
-  if (!(isContract() ? ShallowContract : ShallowExpand)(*u, false)) {
+  bool changed;
+  const Tree* result;
+  uint32_t hash = memo ? (*u)->hash() : 0;
+  if (memo && memo->find(*u, hash, *this, &result)) {
+    changed = result != nullptr;
+    if (changed) {
+      *u = (*u)->cloneTreeOverTree(result);
+    }
+  } else {
+    int entry = memo ? memo->prepare(*u, hash, *this) : -1;
+    changed = (isContract() ? ShallowContract : ShallowExpand)(*u, false);
+    if (entry >= 0) {
+      memo->complete(entry, changed ? *u : nullptr);
+    }
+  }
+  if (!changed) {
     return false;
   }
   // Apply a deep systematic reduction starting from (*u)
@@ -383,6 +499,15 @@ void AdvancedReduction::Path::log() const {
 
 void AdvancedReduction::UpdateBestMetric(Context* ctx) {
   float metric = Metric::GetMetric(ctx->m_root, ctx->m_reductionTarget);
+#if POINCARE_TREE_LOG
+  if (traceSteps) {
+    std::cout << metric << " (best " << ctx->m_bestMetric << ")";
+    ctx->m_path.log();
+    std::cout << "  ";
+    (ctx->m_root->isDep() ? ctx->m_root->child(0) : ctx->m_root)
+        ->logSerialize();
+  }
+#endif
   if (metric == Metric::k_perfectMetric) {
     ctx->m_bestMetric = Metric::k_perfectMetric;
     ctx->m_bestPath = ctx->m_path;
@@ -510,7 +635,7 @@ bool inline AdvancedReduction::ReduceDirection(Tree* e, Tree* root,
   assert(ctx->canAppendDirection());
   assert(ctx->m_root == root);
   Tree* target = e;
-  if (!dir.applyContractOrExpand(&target, root)) {
+  if (!dir.applyContractOrExpand(&target, root, &ctx->m_operationMemo)) {
     LOG(3, "Nothing to ", dir.log());
     return true;
   }
@@ -16,6 +16,8 @@
 #define ADVANCED_MAX_BREADTH 32
 // Max depth of path advanced reduction can handle
 #define ADVANCED_MAX_DEPTH 8
+// Max number of blocks used to memoize Contract and Expand results
+#define ADVANCED_MEMO_SIZE 2048
 
 namespace Poincare::Internal {
 
@@ -31,8 +33,18 @@ class AdvancedReduction {
   static bool DeepExpandAlgebraic(Tree* e) {
     return PrivateDeepExpand(e, true);
   };
+#if POINCARE_METRICS
+  static uint32_t memoHitCount;
+  static uint32_t memoMissCount;
+#endif
+#if POINCARE_TREE_LOG
+  // Log each explored path with its metric, and the best path found
+  static bool traceSteps;
+#endif
 
  private:
+  class OperationMemo;
+
   // Ordered list of hashes encountered during advanced reduction.
   class CrcCollection {
    public:
@@ -82,10 +94,12 @@ class AdvancedReduction {
     bool apply(Tree** e, Tree* root, bool* treeChanged) const;
     // Return true if direction was applied.
     bool applyNextNode(const Tree** e, const Tree* root) const;
-    // Return true if direction was applied.
-    bool applyContractOrExpand(Tree** e, Tree* root) const;
+    // Return true if direction was applied. Use memo if provided.
+    bool applyContractOrExpand(Tree** e, Tree* root,
+                               OperationMemo* memo = nullptr) const;
     // Constructor needed for Path::m_stack
     Direction() : m_type(0) {}
+    bool operator==(const Direction&) const = default;
     bool isNextNode() const { return !isContract() && !isExpand(); }
 #if POINCARE_TREE_LOG
     void log(bool addLineReturn = true) const;
@@ -112,6 +126,64 @@ class AdvancedReduction {
   };
   static_assert(sizeof(uint8_t) == sizeof(Direction));
 
+  /* Bounded table of the results of shallow Contract and Expand operations.
+   * The same subtrees are reached through many different paths, and most
+   * operations fail on them after trying every pattern. Trees are stored in a
+   * block buffer, entries are looked up by hash and compared structurally.
+   * Large trees are not memoized and the table is cleared once full. */
+  class OperationMemo {
+   public:
+    OperationMemo(ReductionTarget reductionTarget)
+        : m_budget(Budget(reductionTarget)) {
+      clear();
+    }
+    /* Return true if direction has been memoized on a tree identical to e.
+     * result is then set to the resulting tree, or nullptr if the operation
+     * did not apply. */
+    bool find(const Tree* e, uint32_t hash, Direction direction,
+              const Tree** result) const;
+    /* Start memoizing direction on e, return the entry index to complete or -1
+     * if e does not fit. */
+    int prepare(const Tree* e, uint32_t hash, Direction direction);
+    // Complete with the resulting tree, or nullptr if nothing changed.
+    void complete(int index, const Tree* result);
+
+   private:
+    // Blocks available for the memoization, tunable per reduction target
+    constexpr static size_t Budget(ReductionTarget reductionTarget) {
+      return reductionTarget == ReductionTarget::User ? ADVANCED_MEMO_SIZE
+                                                      : ADVANCED_MEMO_SIZE / 2;
+    }
+    constexpr static uint16_t k_noResult = UINT16_MAX;
+    constexpr static size_t k_maxTreeSizeDivider = 16;
+    constexpr static uint8_t k_noEntry = UINT8_MAX;
+    constexpr static size_t k_maxNumberOfEntries = 96;
+    // Open addressing index on hashes, at most half full
+    constexpr static size_t k_indexSize = 2 * k_maxNumberOfEntries;
+    static_assert(k_maxNumberOfEntries < k_noEntry);
+    struct Entry {
+      uint32_t hash;
+      // Offsets of the trees in m_blocks
+      uint16_t input;
+      uint16_t result;
+      Direction direction;
+      bool isComplete;
+    };
+    static size_t IndexSlot(uint32_t hash, Direction direction) {
+      return (hash + (direction == Direction::Contract())) % k_indexSize;
+    }
+    void clear();
+    // Return the offset of e's copy in m_blocks, k_noResult if it can't fit
+    uint16_t store(const Tree* e);
+
+    Entry m_entries[k_maxNumberOfEntries];
+    uint8_t m_index[k_indexSize];
+    Block m_blocks[ADVANCED_MEMO_SIZE];
+    uint8_t m_numberOfEntries;
+    uint16_t m_numberOfBlocks;
+    const uint16_t m_budget;
+  };
+
   // Path in exploration of a tree's advanced reduction.
   class Path {
    public:
@@ -148,6 +220,7 @@ class AdvancedReduction {
         : m_root(root),
           m_bestMetric(bestMetric),
           m_bestHash(bestHash),
+          m_operationMemo(reductionTarget),
           m_reductionTarget(reductionTarget) {}
 
     const Tree* m_root;
@@ -156,6 +229,7 @@ class AdvancedReduction {
     float m_bestMetric;
     uint32_t m_bestHash;
     CrcCollection m_crcCollection;
+    OperationMemo m_operationMemo;
     const ReductionTarget m_reductionTarget;
     bool shouldEarlyExit() const {
       return this->m_bestMetric == Metric::k_perfectMetric;
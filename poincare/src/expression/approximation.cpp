@@ -294,8 +294,8 @@ T FloatBinomial(T n, T k) {
 }
 
 template <typename T>
-static std::complex<T> FloatMultiplication(std::complex<T> c,
-                                           std::complex<T> d) {
+std::complex<T> Private::FloatMultiplication(std::complex<T> c,
+                                             std::complex<T> d) {
   // Special case to prevent (inf,0)*(1,0) from returning (inf, nan).
   if (std::isinf(std::abs(c)) || std::isinf(std::abs(d))) {
     constexpr T zero = static_cast<T>(0.0);
@@ -318,7 +318,7 @@ static std::complex<T> FloatMultiplication(std::complex<T> c,
 }
 
 template <typename T>
-static std::complex<T> FloatDivision(std::complex<T> c, std::complex<T> d) {
+std::complex<T> Private::FloatDivision(std::complex<T> c, std::complex<T> d) {
   if (d.real() == 0 && d.imag() == 0) {
     return NAN;
   }
@@ -336,6 +336,24 @@ static std::complex<T> FloatDivision(std::complex<T> c, std::complex<T> d) {
   return c / d;
 }
 
+template <typename T>
+std::complex<T> Private::SquareRoot(std::complex<T> c) {
+  if (c == std::complex<T>(0)) {
+    return 0;
+  }
+  /* With c real <0 and |c| big enough, the approximation errors of
+   * std::sqrt become so big that [NeglectRealOrImaginaryPartIfNegligible]
+   * fails to remove them, we use the std::sqrt of real for this case */
+  if (c.imag() == 0) {
+    /* √c with "c" real is:
+     * 1. √c if c>0
+     * 2. √(-c)*i if c<0 */
+    return c.real() > 0 ? std::sqrt(c.real())
+                        : std::complex<T>(0, std::sqrt(-c.real()));
+  }
+  return NeglectRealOrImaginaryPartIfNegligible(std::sqrt(c), c);
+}
+
 /* Return highest order of undefined dependencies if there is at least one, zero
  * otherwise */
 std::complex<float> Private::HelperUndefDependencies(const Tree* dep,
@@ -449,23 +467,8 @@ std::complex<T> BasicToComplex(const Tree* e, const Context* ctx) {
       }
       return result;
     }
-    case Type::Sqrt: {
-      std::complex<T> c = PrivateToComplex<T>(e->child(0), ctx);
-      if (c == std::complex<T>(0)) {
-        return 0;
-      }
-      /* With c real <0 and |c| big enough, the approximation errors of
-       * std::sqrt become so big that [NeglectRealOrImaginaryPartIfNegligible]
-       * fails to remove them, we use the std::sqrt of real for this case */
-      if (c.imag() == 0) {
-        /* √c with "c" real is:
-         * 1. √c if c>0
-         * 2. √(-c)*i if c<0 */
-        return c.real() > 0 ? std::sqrt(c.real())
-                            : std::complex<T>(0, std::sqrt(-c.real()));
-      }
-      return NeglectRealOrImaginaryPartIfNegligible(std::sqrt(c), c);
-    }
+    case Type::Sqrt:
+      return SquareRoot<T>(PrivateToComplex<T>(e->child(0), ctx));
     case Type::Root: {
       return ApproximateRoot<T>(e, ctx);
     }
@@ -1851,6 +1854,19 @@ template Coordinate2D<double> ToPoint(const Tree*, Parameters, const Context&);
 template float FloatBinomial(float, float);
 template double FloatBinomial(double, double);
 
+template std::complex<float> Private::FloatMultiplication(std::complex<float>,
+                                                          std::complex<float>);
+template std::complex<double> Private::FloatMultiplication(
+    std::complex<double>, std::complex<double>);
+
+template std::complex<float> Private::FloatDivision(std::complex<float>,
+                                                    std::complex<float>);
+template std::complex<double> Private::FloatDivision(std::complex<double>,
+                                                     std::complex<double>);
+
+template std::complex<float> Private::SquareRoot(std::complex<float>);
+template std::complex<double> Private::SquareRoot(std::complex<double>);
+
 template std::complex<float> Private::PrivateToComplex(const Tree*,
                                                        const Context*);
 template std::complex<double> Private::PrivateToComplex(const Tree*,
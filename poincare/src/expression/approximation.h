@@ -267,6 +267,15 @@ inline void ToComplexTreeInplace(Tree* e, const Context* ctx) {
   e->moveTreeOverTree(ToComplexTree<double>(e, ctx));
 }
 
+// Multiplication and division handling infinite operands
+template <typename T>
+std::complex<T> FloatMultiplication(std::complex<T> c, std::complex<T> d);
+template <typename T>
+std::complex<T> FloatDivision(std::complex<T> c, std::complex<T> d);
+
+template <typename T>
+std::complex<T> SquareRoot(std::complex<T> c);
+
 template <typename T>
 std::complex<T> TrigonometricToComplex(TypeBlock type, std::complex<T> value,
                                        AngleUnit angleUnit);
@@ -288,6 +297,17 @@ template <typename T>
 std::complex<T> ApproximatePower(const Tree* power, const Context* ctx,
                                  ComplexFormat complexFormat);
 
+template <typename T>
+std::complex<T> ComputeComplexPower(const std::complex<T> c,
+                                    const std::complex<T> d,
+                                    ComplexFormat complexFormat);
+
+/* Return the real root of c^(p/q) when it exists and is not the principal
+ * root, NAN otherwise. */
+template <typename T>
+std::complex<T> ComputeNotPrincipalRealRootOfRationalPow(
+    const std::complex<T> c, T p, T q);
+
 template <typename T>
 std::complex<T> ApproximateRoot(const Tree* root, const Context* ctx);
 
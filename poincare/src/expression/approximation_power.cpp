@@ -5,14 +5,6 @@
 
 namespace Poincare::Internal::Approximation::Private {
 
-template <typename T>
-static std::complex<T> ComputeComplexPower(const std::complex<T> c,
-                                           const std::complex<T> d,
-                                           ComplexFormat complexFormat);
-template <typename T>
-static std::complex<T> ComputeNotPrincipalRealRootOfRationalPow(
-    const std::complex<T> c, T p, T q);
-
 template <typename T>
 std::complex<T> ComputeComplexPower(const std::complex<T> c,
                                     const std::complex<T> d,
@@ -194,6 +186,13 @@ template std::complex<double> ApproximatePower(const Tree*, const Context*,
 template std::complex<float> ApproximateRoot(const Tree*, const Context*);
 template std::complex<double> ApproximateRoot(const Tree*, const Context*);
 
+template std::complex<float> ComputeComplexPower(const std::complex<float>,
+                                                const std::complex<float>,
+                                                ComplexFormat);
+template std::complex<double> ComputeComplexPower(const std::complex<double>,
+                                                 const std::complex<double>,
+                                                 ComplexFormat);
+
 template std::complex<float> ComputeNotPrincipalRealRootOfRationalPow(
     const std::complex<float>, float, float);
 template std::complex<double> ComputeNotPrincipalRealRootOfRationalPow(
@@ -0,0 +1,605 @@
+#include "approximation_program.h"
+
+#include <omg/float.h>
+
+#include <algorithm>
+
+#include "dependency.h"
+#include "dimension.h"
+#include "number.h"
+#include "rational.h"
+#include "undefined.h"
+#include "variables.h"
+
+namespace Poincare::Internal::Approximation {
+
+using namespace Private;
+
+Program Program::Compile(const Tree* e, const Context& context) {
+  Program program;
+  program.m_angleUnit = context.m_angleUnit;
+  program.m_complexFormat = context.m_complexFormat;
+  if (!Dimension::IsNonListScalar(e) || !program.compile(e, 0)) {
+    return Program();
+  }
+  return program;
+}
+
+bool Program::pushInstruction(OpCode opCode, uint8_t reg, uint8_t arg,
+                              bool isNodeResult) {
+  if (m_numberOfInstructions >= k_maxNumberOfInstructions ||
+      reg >= k_maxNumberOfRegisters) {
+    return false;
+  }
+  m_instructions[m_numberOfInstructions++] = {
+      .opCode = opCode, .reg = reg, .arg = arg, .isNodeResult = isNodeResult};
+  return true;
+}
+
+uint8_t Program::pushConstant(double value) {
+  for (uint8_t i = 0; i < m_numberOfConstants; i++) {
+    // Compare representations to also share NANs
+    if (m_constants[i] == value ||
+        (std::isnan(m_constants[i]) && std::isnan(value))) {
+      return i;
+    }
+  }
+  if (m_numberOfConstants >= k_maxNumberOfConstants) {
+    return k_noArgument;
+  }
+  m_constants[m_numberOfConstants] = value;
+  return m_numberOfConstants++;
+}
+
+bool Program::compileChildren(const Tree* e, uint8_t reg) {
+  for (IndexedChild<const Tree*> child : e->indexedChildren()) {
+    if (!compile(child, reg + child.index)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool Program::compilePow(const Tree* e, uint8_t reg, OpCode opCode,
+                         ComplexFormat complexFormat) {
+  /* Mimic ApproximatePower: in real complex format, c^(p/q) may have a real
+   * root which is not the principal root. */
+  uint8_t rational = k_noArgument;
+  const Tree* exponent = e->child(1);
+  if (complexFormat == ComplexFormat::Real) {
+    double p = NAN;
+    double q = NAN;
+    if (exponent->isRational()) {
+      p = Rational::Numerator(exponent).to<double>();
+      q = Rational::Denominator(exponent).to<double>();
+    } else if (exponent->isDiv() && exponent->child(0)->isInteger() &&
+               exponent->child(1)->isInteger()) {
+      p = Number::To<double>(exponent->child(0));
+      q = Number::To<double>(exponent->child(1));
+    }
+    if (!std::isnan(p) && !std::isnan(q)) {
+      /* p and q must be stored next to each other, push them even if one is
+       * already a constant. */
+      if (m_numberOfConstants + 2 > k_maxNumberOfConstants) {
+        return false;
+      }
+      rational = m_numberOfConstants;
+      m_constants[m_numberOfConstants++] = p;
+      m_constants[m_numberOfConstants++] = q;
+    }
+  }
+  return compileChildren(e, reg) && pushInstruction(opCode, reg, rational);
+}
+
+bool Program::compile(const Tree* e, uint8_t reg) {
+  if (reg >= k_maxNumberOfRegisters) {
+    return false;
+  }
+  if (e->isUndefined()) {
+    if (e->isNonReal()) {
+      return pushInstruction(OpCode::LoadNonReal, reg);
+    }
+    uint8_t index = pushConstant(NAN);
+    return index != k_noArgument &&
+           pushInstruction(OpCode::LoadConstant, reg, index);
+  }
+  if (e->isNumber()) {
+    uint8_t index = pushConstant(Number::To<double>(e));
+    return index != k_noArgument &&
+           pushInstruction(OpCode::LoadConstant, reg, index);
+  }
+  switch (e->type()) {
+    case Type::Var:
+      return Variables::Id(e) == 0 &&
+             pushInstruction(OpCode::LoadVariable, reg);
+    case Type::ComplexI:
+      // i is never turned into nonreal, see PrivateToComplex
+      return pushInstruction(OpCode::LoadComplexI, reg, k_noArgument, false);
+    case Type::Inf: {
+      uint8_t index = pushConstant(INFINITY);
+      return index != k_noArgument &&
+             pushInstruction(OpCode::LoadConstant, reg, index);
+    }
+    case Type::Parentheses:
+      return compile(e->child(0), reg);
+    case Type::Add:
+    case Type::Mult: {
+      OpCode opCode = e->isAdd() ? OpCode::Add : OpCode::Mult;
+      int n = e->numberOfChildren();
+      const Tree* child = e->child(0);
+      if (!compile(child, reg)) {
+        return false;
+      }
+      for (int i = 1; i < n; i++) {
+        child = child->nextTree();
+        if (!compile(child, reg + 1) ||
+            !pushInstruction(opCode, reg, k_noArgument, i == n - 1)) {
+          return false;
+        }
+      }
+      return true;
+    }
+    case Type::Sub:
+    case Type::Div:
+      return compileChildren(e, reg) &&
+             pushInstruction(e->isSub() ? OpCode::Sub : OpCode::Div, reg);
+    case Type::Pow:
+      return compilePow(e, reg, OpCode::Pow, m_complexFormat);
+    case Type::PowReal:
+      return compilePow(e, reg, OpCode::PowReal, ComplexFormat::Real);
+    case Type::Ln:
+    case Type::Log:
+      if (e->child(0)->isPow()) {
+        // ln(a^b) is approximated as b*ln(a), see ApproximateLnOfPower
+        return compilePow(e->child(0), reg,
+                          e->isLn() ? OpCode::LnOfPow : OpCode::LogOfPow,
+                          m_complexFormat);
+      }
+      return compile(e->child(0), reg) &&
+             pushInstruction(e->isLn() ? OpCode::Ln : OpCode::Log, reg);
+    case Type::Opposite:
+    case Type::Sqrt:
+    case Type::Exp:
+    case Type::Abs:
+    case Type::Arg:
+    case Type::Conj:
+    case Type::Re:
+    case Type::Im:
+    case Type::NonNull:
+    case Type::Real:
+    case Type::RealPos: {
+      OpCode opCode;
+      switch (e->type()) {
+        case Type::Opposite:
+          opCode = OpCode::Opposite;
+          break;
+        case Type::Sqrt:
+          opCode = OpCode::Sqrt;
+          break;
+        case Type::Exp:
+          opCode = OpCode::Exp;
+          break;
+        case Type::Abs:
+          opCode = OpCode::Abs;
+          break;
+        case Type::Arg:
+          opCode = OpCode::Arg;
+          break;
+        case Type::Conj:
+          opCode = OpCode::Conj;
+          break;
+        case Type::Re:
+          opCode = OpCode::Re;
+          break;
+        case Type::Im:
+          opCode = OpCode::Im;
+          break;
+        case Type::NonNull:
+          opCode = OpCode::NonNull;
+          break;
+        case Type::Real:
+          opCode = OpCode::Real;
+          break;
+        default:
+          assert(e->isRealPos());
+          opCode = OpCode::RealPos;
+      }
+      return compile(e->child(0), reg) && pushInstruction(opCode, reg);
+    }
+    case Type::Cos:
+    case Type::Sin:
+    case Type::Tan:
+    case Type::Sec:
+    case Type::Csc:
+    case Type::Cot:
+    case Type::ACos:
+    case Type::ASin:
+    case Type::ATan:
+    case Type::ASec:
+    case Type::ACsc:
+    case Type::ACot:
+      return compile(e->child(0), reg) &&
+             pushInstruction(OpCode::Trigonometry, reg, e->type());
+    case Type::ATanRad:
+      return compile(e->child(0), reg) &&
+             pushInstruction(OpCode::TrigonometryRadian, reg, Type::ATan);
+    case Type::Trig:
+    case Type::ATrig: {
+      // The second child is known to be 0 (cosine) or 1 (sine)
+      const Tree* selector = e->child(1);
+      if (!selector->isNumber()) {
+        return false;
+      }
+      bool isCos = Number::IsNull(selector);
+      Type type = e->isTrig() ? (isCos ? Type::Cos : Type::Sin)
+                              : (isCos ? Type::ACos : Type::ASin);
+      return compile(e->child(0), reg) &&
+             pushInstruction(OpCode::TrigonometryRadian, reg, type);
+    }
+    case Type::SinH:
+    case Type::CosH:
+    case Type::TanH:
+    case Type::ArSinH:
+    case Type::ArCosH:
+    case Type::ArTanH:
+      return compile(e->child(0), reg) &&
+             pushInstruction(OpCode::Hyperbolic, reg, e->type());
+    case Type::Floor:
+    case Type::Ceil:
+    case Type::Frac:
+    case Type::Sign:
+    case Type::SignUser:
+      return compile(e->child(0), reg) &&
+             pushInstruction(OpCode::RealFunction, reg, e->type());
+    case Type::Dep: {
+      int beginIndex = m_numberOfInstructions;
+      if (!pushInstruction(OpCode::BeginDependencies, reg)) {
+        return false;
+      }
+      for (const Tree* dependency :
+           Dependency::Dependencies(e)->children()) {
+        if (!Dimension::IsNonListScalar(dependency) ||
+            !compile(dependency, reg + 1) ||
+            !pushInstruction(OpCode::MergeDependency, reg, k_noArgument,
+                             false)) {
+          return false;
+        }
+      }
+      m_instructions[beginIndex].arg =
+          m_numberOfInstructions - beginIndex - 1;
+      return compile(Dependency::Main(e), reg + 1) &&
+             pushInstruction(OpCode::EndDependencies, reg);
+    }
+    default:
+      return false;
+  }
+}
+
+template <typename T>
+std::complex<T> Program::power(std::complex<T> c, std::complex<T> d,
+                               uint8_t rational,
+                               ComplexFormat complexFormat) const {
+  if (rational != k_noArgument) {
+    std::complex<T> result = ComputeNotPrincipalRealRootOfRationalPow<T>(
+        c, m_constants[rational], m_constants[rational + 1]);
+    if (!std::isnan(result.real()) && !std::isnan(result.imag())) {
+      return result;
+    }
+  }
+  return ComputeComplexPower<T>(c, d, complexFormat);
+}
+
+template <typename T>
+static std::complex<T> RealFunction(TypeBlock type, T x) {
+  // Same as ToComplexSwitchOnlyReal
+  switch (type) {
+    case Type::Sign:
+    case Type::SignUser:
+      return std::fabs(x) <= OMG::Float::Epsilon<T>() ? 0 : x < 0 ? -1 : 1;
+    case Type::Floor:
+    case Type::Ceil: {
+      T delta = std::fabs((std::round(x) - x) / x);
+      if (delta <= OMG::Float::Epsilon<T>()) {
+        return std::round(x);
+      }
+      return type.isFloor() ? std::floor(x) : std::ceil(x);
+    }
+    default:
+      assert(type.isFrac());
+      return x - std::floor(x);
+  }
+}
+
+#if POINCARE_NO_FLOAT_APPROXIMATION
+using DependencyFloat = double;
+#else
+using DependencyFloat = float;
+#endif
+
+template <typename T, typename F>
+static void ForEachLane(std::complex<T>* r, int n, F f) {
+  for (int lane = 0; lane < n; lane++) {
+    f(r[lane], lane);
+  }
+}
+
+template <typename T>
+void Program::execute(int start, int end, const T* x, int n,
+                      std::complex<T>* registers) const {
+  assert(0 < n && n <= k_batchSize);
+  for (int i = start; i < end; i++) {
+    const Instruction& instruction = m_instructions[i];
+    std::complex<T>* r = registers + instruction.reg * n;
+    // Only valid for binary operations and dependencies
+    const std::complex<T>* next = r + n;
+    switch (instruction.opCode) {
+      case OpCode::LoadConstant: {
+        std::complex<T> constant = static_cast<T>(m_constants[instruction.arg]);
+        ForEachLane(r, n, [&](std::complex<T>& v, int) { v = constant; });
+        break;
+      }
+      case OpCode::LoadVariable:
+        ForEachLane(r, n, [&](std::complex<T>& v, int l) { v = x[l]; });
+        break;
+      case OpCode::LoadComplexI:
+        ForEachLane(r, n,
+                    [](std::complex<T>& v, int) { v = std::complex<T>(0, 1); });
+        break;
+      case OpCode::LoadNonReal:
+        ForEachLane(r, n, [](std::complex<T>& v, int) { v = NonReal<T>(); });
+        break;
+      case OpCode::Add:
+        ForEachLane(r, n, [&](std::complex<T>& v, int l) { v += next[l]; });
+        break;
+      case OpCode::Mult:
+        ForEachLane(r, n, [&](std::complex<T>& v, int l) {
+          v = FloatMultiplication<T>(v, next[l]);
+        });
+        break;
+      case OpCode::Sub:
+        ForEachLane(r, n, [&](std::complex<T>& v, int l) { v -= next[l]; });
+        break;
+      case OpCode::Div:
+        ForEachLane(r, n, [&](std::complex<T>& v, int l) {
+          v = FloatDivision<T>(v, next[l]);
+        });
+        break;
+      case OpCode::Pow:
+        ForEachLane(r, n, [&](std::complex<T>& v, int l) {
+          v = power<T>(v, next[l], instruction.arg, m_complexFormat);
+        });
+        break;
+      case OpCode::PowReal:
+        ForEachLane(r, n, [&](std::complex<T>& v, int l) {
+          if (v.imag() != 0 || std::isnan(v.real()) || next[l].imag() != 0 ||
+              std::isnan(next[l].real())) {
+            v = NAN;
+          } else {
+            v = power<T>(v, next[l], instruction.arg, ComplexFormat::Real);
+          }
+        });
+        break;
+      case OpCode::LnOfPow:
+      case OpCode::LogOfPow: {
+        bool isLog = instruction.opCode == OpCode::LogOfPow;
+        ForEachLane(r, n, [&](std::complex<T>& v, int l) {
+          if (v.imag() == 0 && next[l].imag() == 0 && !std::isnan(v.real()) &&
+              !std::isnan(next[l].real()) && v.real() >= 0) {
+            v = next[l].real() * ComplexLogarithm<T>(v, isLog);
+            return;
+          }
+          std::complex<T> pow =
+              power<T>(v, next[l], instruction.arg, m_complexFormat);
+          if (m_complexFormat == ComplexFormat::Real && pow.imag() != 0 &&
+              !Undefined::IsUndefined(pow)) {
+            pow = NonReal<T>();
+          }
+          v = static_cast<T>(1.0) * ComplexLogarithm<T>(pow, isLog);
+        });
+        break;
+      }
+      case OpCode::Opposite:
+        ForEachLane(r, n, [](std::complex<T>& v, int) {
+          v = FloatMultiplication<T>(-1, v);
+        });
+        break;
+      case OpCode::Sqrt:
+        ForEachLane(r, n,
+                    [](std::complex<T>& v, int) { v = SquareRoot<T>(v); });
+        break;
+      case OpCode::Exp:
+        ForEachLane(r, n, [](std::complex<T>& v, int) { v = std::exp(v); });
+        break;
+      case OpCode::Ln:
+      case OpCode::Log: {
+        bool isLog = instruction.opCode == OpCode::Log;
+        ForEachLane(r, n, [&](std::complex<T>& v, int) {
+          v = static_cast<T>(1.0) * ComplexLogarithm<T>(v, isLog);
+        });
+        break;
+      }
+      case OpCode::Abs:
+        ForEachLane(r, n, [](std::complex<T>& v, int) { v = std::abs(v); });
+        break;
+      case OpCode::Arg:
+        ForEachLane(r, n, [](std::complex<T>& v, int) { v = std::arg(v); });
+        break;
+      case OpCode::Conj:
+        ForEachLane(r, n, [](std::complex<T>& v, int) { v = std::conj(v); });
+        break;
+      case OpCode::Re:
+        ForEachLane(r, n, [](std::complex<T>& v, int) {
+          v = std::isnan(v.imag()) ? NAN : v.real();
+        });
+        break;
+      case OpCode::Im:
+        ForEachLane(r, n, [](std::complex<T>& v, int) {
+          v = std::isnan(v.real()) ? NAN : v.imag();
+        });
+        break;
+      case OpCode::NonNull:
+        ForEachLane(r, n, [](std::complex<T>& v, int) {
+          if (v == std::complex<T>(0.0)) {
+            v = NAN;
+          }
+        });
+        break;
+      case OpCode::Real:
+        ForEachLane(r, n, [](std::complex<T>& v, int) {
+          if (v.imag() != 0.0) {
+            v = NAN;
+          }
+        });
+        break;
+      case OpCode::RealPos:
+        ForEachLane(r, n, [](std::complex<T>& v, int) {
+          if (v.real() < 0.0 || v.imag() != 0.0) {
+            v = NonReal<T>();
+          }
+        });
+        break;
+      case OpCode::Trigonometry:
+      case OpCode::TrigonometryRadian: {
+        TypeBlock type = TypeBlock(Type(instruction.arg));
+        AngleUnit angleUnit = instruction.opCode == OpCode::Trigonometry
+                                  ? m_angleUnit
+                                  : AngleUnit::Radian;
+        ForEachLane(r, n, [&](std::complex<T>& v, int) {
+          v = TrigonometricToComplex<T>(type, v, angleUnit);
+        });
+        break;
+      }
+      case OpCode::Hyperbolic: {
+        TypeBlock type = TypeBlock(Type(instruction.arg));
+        ForEachLane(r, n, [&](std::complex<T>& v, int) {
+          v = HyperbolicToComplex<T>(type, v);
+        });
+        break;
+      }
+      case OpCode::RealFunction: {
+        TypeBlock type = TypeBlock(Type(instruction.arg));
+        ForEachLane(r, n, [&](std::complex<T>& v, int) {
+          v = (v.imag() != 0 || std::isnan(v.real()))
+                  ? NAN
+                  : RealFunction<T>(type, v.real());
+        });
+        break;
+      }
+      case OpCode::BeginDependencies: {
+        /* Dependencies are approximated in float, as in
+         * HelperUndefDependencies. */
+        DependencyFloat dependencyX[k_batchSize];
+        std::complex<DependencyFloat>
+            dependencyRegisters[k_maxNumberOfRegisters * k_batchSize];
+        std::complex<DependencyFloat>* undef =
+            dependencyRegisters + instruction.reg * n;
+        for (int l = 0; l < n; l++) {
+          dependencyX[l] = x[l];
+          undef[l] = 0;
+        }
+        execute<DependencyFloat>(i + 1, i + 1 + instruction.arg, dependencyX,
+                                 n, dependencyRegisters);
+        ForEachLane(r, n, [&](std::complex<T>& v, int l) {
+          std::complex<float> u = static_cast<std::complex<float>>(undef[l]);
+          v = IsNonReal(u) ? NonReal<T>() : std::complex<T>(u);
+        });
+        i += instruction.arg;
+        // Skip the node result check, r is not the approximation of a node
+        continue;
+      }
+      case OpCode::MergeDependency:
+        ForEachLane(r, n, [&](std::complex<T>& v, int l) {
+          // Only update to nonreal if there is no undef to respect priority
+          if (IsNonReal(next[l]) && v == std::complex<T>(0)) {
+            v = next[l];
+          } else if (std::isnan(next[l].real())) {
+            v = NAN;
+          }
+        });
+        break;
+      case OpCode::EndDependencies:
+        ForEachLane(r, n, [&](std::complex<T>& v, int l) {
+          if (v == std::complex<T>(0.0)) {
+            v = next[l];
+          }
+        });
+        break;
+    }
+    // Same as PrivateToComplex
+    if (instruction.isNodeResult && m_complexFormat == ComplexFormat::Real) {
+      ForEachLane(r, n, [](std::complex<T>& v, int) {
+        if (v.imag() != 0 && !Undefined::IsUndefined(v)) {
+          v = NonReal<T>();
+        }
+      });
+    }
+  }
+}
+
+template <typename T>
+static T RealValue(std::complex<T> value) {
+  // Remove signaling nan
+  return value.imag() == 0 && !IsNonReal(value) ? value.real() : NAN;
+}
+
+template <typename T>
+std::complex<T> Program::toComplex(T x) const {
+  assert(isValid());
+#if POINCARE_NO_FLOAT_APPROXIMATION
+  if constexpr (sizeof(T) == sizeof(float)) {
+    return static_cast<std::complex<T>>(toComplex<double>(x));
+  }
+#endif
+  std::complex<T> registers[k_maxNumberOfRegisters];
+  execute<T>(0, m_numberOfInstructions, &x, 1, registers);
+  return registers[0];
+}
+
+template <typename T>
+T Program::to(T x) const {
+  // Same as ToPointOrRealScalar: a NAN abscissa is never approximated
+  return std::isnan(x) ? NAN : RealValue(toComplex<T>(x));
+}
+
+template <typename T>
+void Program::to(std::span<const T> x, std::span<T> values) const {
+  assert(isValid() && x.size() == values.size());
+#if POINCARE_NO_FLOAT_APPROXIMATION
+  if constexpr (sizeof(T) == sizeof(float)) {
+    double doubleX[k_batchSize];
+    double doubleValues[k_batchSize];
+    for (size_t start = 0; start < x.size(); start += k_batchSize) {
+      size_t n = std::min<size_t>(k_batchSize, x.size() - start);
+      for (size_t l = 0; l < n; l++) {
+        doubleX[l] = x[start + l];
+      }
+      to<double>(std::span<const double>(doubleX, n),
+                 std::span<double>(doubleValues, n));
+      for (size_t l = 0; l < n; l++) {
+        values[start + l] = doubleValues[l];
+      }
+    }
+    return;
+  }
+#endif
+  std::complex<T> registers[k_maxNumberOfRegisters * k_batchSize];
+  for (size_t start = 0; start < x.size(); start += k_batchSize) {
+    int n = std::min<size_t>(k_batchSize, x.size() - start);
+    execute<T>(0, m_numberOfInstructions, x.data() + start, n, registers);
+    for (int l = 0; l < n; l++) {
+      values[start + l] =
+          std::isnan(x[start + l]) ? NAN : RealValue(registers[l]);
+    }
+  }
+}
+
+template float Program::to(float) const;
+template double Program::to(double) const;
+
+template void Program::to(std::span<const float>, std::span<float>) const;
+template void Program::to(std::span<const double>, std::span<double>) const;
+
+template std::complex<float> Program::toComplex(float) const;
+template std::complex<double> Program::toComplex(double) const;
+
+}  // namespace Poincare::Internal::Approximation
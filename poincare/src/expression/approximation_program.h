@@ -0,0 +1,141 @@
+#ifndef POINCARE_EXPRESSION_APPROXIMATION_PROGRAM_H
+#define POINCARE_EXPRESSION_APPROXIMATION_PROGRAM_H
+
+#include <poincare/src/memory/tree.h>
+
+#include <complex>
+#include <span>
+
+#include "approximation.h"
+
+namespace Poincare::Internal::Approximation {
+
+/* A Program is a flat translation of a prepared and optimized scalar tree (see
+ * PrepareFunctionForApproximation) into a linear sequence of register machine
+ * instructions. It is meant to be compiled once and approximated many times
+ * with different values of the local variable of id 0 (function plots, values
+ * tables, solver...) without walking the tree, switching on its types and
+ * re-checking its dimension at each call.
+ *
+ * Registers are allocated along the evaluation depth: a node evaluated in
+ * register r evaluates its next children in register r+1 and combines them
+ * into r. Operations share their arithmetic with the tree approximation so
+ * that both approximate to the same values, up to the sign of zeros and the
+ * payload of NANs.
+ *
+ * Only the most common scalar types are handled. Compile returns an invalid
+ * program if the tree contains anything else (lists, piecewise, randoms, user
+ * symbols...) or does not fit, in which case the tree must be approximated. */
+
+class Program {
+ public:
+  constexpr static int k_maxNumberOfInstructions = 32;
+  constexpr static int k_maxNumberOfConstants = 12;
+  constexpr static int k_maxNumberOfRegisters = 8;
+  /* Abscissas are approximated by batches of k_batchSize: each instruction is
+   * decoded once per batch and applied to all of its lanes. */
+  constexpr static int k_batchSize = 16;
+
+  Program() : m_numberOfInstructions(0), m_numberOfConstants(0) {}
+
+  static Program Compile(const Tree* e, const Context& context = Context());
+
+  bool isValid() const { return m_numberOfInstructions > 0; }
+  int numberOfInstructions() const { return m_numberOfInstructions; }
+
+  /* Same as Approximation::To with a value for VarX: approximate to a real
+   * scalar, NAN if the result is complex or undefined. */
+  template <typename T>
+  T to(T x) const;
+  template <typename T>
+  std::complex<T> toComplex(T x) const;
+  // Approximate at each abscissa of x into values, which has the same size
+  template <typename T>
+  void to(std::span<const T> x, std::span<T> values) const;
+
+ private:
+  enum class OpCode : uint8_t {
+    // r <- m_constants[arg]
+    LoadConstant,
+    // r <- x
+    LoadVariable,
+    LoadComplexI,
+    LoadNonReal,
+    // r <- r op r+1
+    Add,
+    Mult,
+    Sub,
+    Div,
+    /* r <- r^(r+1), arg is the index of the constants p and q when the
+     * exponent is p/q and real roots must be searched for. */
+    Pow,
+    PowReal,
+    // r <- ln(r^(r+1)) or log(r^(r+1)), arg as for Pow
+    LnOfPow,
+    LogOfPow,
+    // r <- f(r)
+    Opposite,
+    Sqrt,
+    Exp,
+    Ln,
+    Log,
+    Abs,
+    Arg,
+    Conj,
+    Re,
+    Im,
+    NonNull,
+    Real,
+    RealPos,
+    // r <- f(r) with f of type arg
+    Trigonometry,
+    TrigonometryRadian,
+    Hyperbolic,
+    RealFunction,
+    /* Dependencies are evaluated in float, in the arg instructions following
+     * BeginDependencies. Each of them is merged into r by MergeDependency.
+     * EndDependencies then sets r to r+1 (the main tree) if r is still null. */
+    BeginDependencies,
+    MergeDependency,
+    EndDependencies,
+  };
+
+  struct Instruction {
+    OpCode opCode;
+    uint8_t reg;
+    uint8_t arg;
+    // True if this instruction sets the approximation of a whole node
+    bool isNodeResult;
+  };
+
+  constexpr static uint8_t k_noArgument = UINT8_MAX;
+
+  bool compile(const Tree* e, uint8_t reg);
+  bool compileChildren(const Tree* e, uint8_t reg);
+  bool compilePow(const Tree* e, uint8_t reg, OpCode opCode,
+                  ComplexFormat complexFormat);
+  bool pushInstruction(OpCode opCode, uint8_t reg, uint8_t arg = k_noArgument,
+                       bool isNodeResult = true);
+  // Return the index of the constant or k_noArgument if there is no room
+  uint8_t pushConstant(double value);
+
+  /* Registers hold n lanes each, lane l of register r being
+   * registers[r * n + l] for the abscissa x[l]. */
+  template <typename T>
+  void execute(int start, int end, const T* x, int n,
+               std::complex<T>* registers) const;
+  template <typename T>
+  std::complex<T> power(std::complex<T> c, std::complex<T> d, uint8_t rational,
+                        ComplexFormat complexFormat) const;
+
+  Instruction m_instructions[k_maxNumberOfInstructions];
+  double m_constants[k_maxNumberOfConstants];
+  uint8_t m_numberOfInstructions;
+  uint8_t m_numberOfConstants;
+  AngleUnit m_angleUnit;
+  ComplexFormat m_complexFormat;
+};
+
+}  // namespace Poincare::Internal::Approximation
+
+#endif
@@ -189,6 +189,10 @@ static bool ReduceMultiplicationWithInf(Tree* e) {
   // x*inf -> sign(x)*inf
   // Except when x = -i,-1,0,1,i or sign (to avoid infinite loop)
   // TODO: check for |x| = 0 or 1 when `sign(z)=exp(i*arg(z))` is implemented.
+  // Most multiplications have no inf child, avoid computing their dimension
+  if (!e->hasChildSatisfying([](const Tree* e) { return e->isInf(); })) {
+    return false;
+  }
   PatternMatching::Context ctx;
   if (Dimension::Get(e).isScalar() &&
       PatternMatching::Match(e, KMult(KA_s, KInf, KB_s), &ctx)) {
@@ -226,20 +226,27 @@ void Grid::computePositions(KDFont::Size font, KDCoordinate* rows,
 }
 
 KDSize Grid::size(KDFont::Size font) const {
-  int rows = numberOfRows();
-  int columns = numberOfColumns();
-  bool editing = isEditing();
   KDCoordinate columsCumulatedWidth[Matrix::k_maximumSize];
   KDCoordinate rowCumulatedHeight[Matrix::k_maximumSize];
   computePositions(font, rowCumulatedHeight, columsCumulatedWidth);
-  assert(rows >= 2 || (rows == 1 && (numberOfRowsIsFixed() || editing)));
-  assert(columns >= 2 ||
-         (columns == 1 && (numberOfColumnsIsFixed() || editing)));
-  KDCoordinate width = columsCumulatedWidth
-      [columns - 1 - static_cast<int>(!numberOfColumnsIsFixed() && !editing)];
+  return sizeGivenPositions(rowCumulatedHeight, columsCumulatedWidth);
+}
+
+KDSize Grid::sizeGivenPositions(const KDCoordinate* rows,
+                                const KDCoordinate* columns) const {
+  int numberOfRows = this->numberOfRows();
+  int numberOfColumns = this->numberOfColumns();
+  bool editing = isEditing();
+  assert(numberOfRows >= 2 ||
+         (numberOfRows == 1 && (numberOfRowsIsFixed() || editing)));
+  assert(numberOfColumns >= 2 ||
+         (numberOfColumns == 1 && (numberOfColumnsIsFixed() || editing)));
+  KDCoordinate width =
+      columns[numberOfColumns - 1 -
+              static_cast<int>(!numberOfColumnsIsFixed() && !editing)];
   KDCoordinate height =
-      rowCumulatedHeight[rows - 1 -
-                         static_cast<int>(!numberOfRowsIsFixed() && !editing)];
+      rows[numberOfRows - 1 -
+           static_cast<int>(!numberOfRowsIsFixed() && !editing)];
   return KDSize(width, height);
 }
 
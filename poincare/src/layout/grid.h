@@ -70,6 +70,9 @@ class Grid : public Layout {
   void computePositions(KDFont::Size font, KDCoordinate* rows,
                         KDCoordinate* columns) const;
   KDSize size(KDFont::Size font) const;
+  // Size from the cumulated positions filled by computePositions
+  KDSize sizeGivenPositions(const KDCoordinate* rows,
+                            const KDCoordinate* columns) const;
   KDPoint positionOfChildAt(int row, int column, KDFont::Size font) const;
 
   constexpr static int k_minimalNumberOfRowsAndColumnsWhileEditing = 2;
@@ -0,0 +1,137 @@
+#include "rack_cache.h"
+
+#include <poincare/preferences.h>
+
+namespace Poincare::Internal {
+
+RackCache::Entry RackCache::s_entries[k_numberOfEntries];
+
+/* The hash of the blocks b0…bn is Σ bi·B^(n-i) modulo 2^32, so that the hash
+ * of a range of blocks can be deduced from the hashes of its two prefixes. */
+constexpr static uint32_t k_hashBase = 0x01000193;
+
+static uint32_t Power(uint32_t base, uint32_t exponent) {
+  uint32_t result = 1;
+  while (exponent > 0) {
+    if (exponent & 1) {
+      result *= base;
+    }
+    base *= base;
+    exponent >>= 1;
+  }
+  return result;
+}
+
+void RackCache::Reset() {
+  for (Entry& entry : s_entries) {
+    entry.key = k_noKey;
+  }
+}
+
+RackCache::Entry* RackCache::EntryForKey(uint32_t key) {
+  assert(key != k_noKey);
+  // Fibonacci hashing spreads keys that only differ in their high bits
+  constexpr int k_indexBits = 8;
+  static_assert(k_numberOfEntries == 1 << k_indexBits);
+  return &s_entries[(key * 2654435769u) >> (32 - k_indexBits)];
+}
+
+bool RackCache::Get(uint32_t key, KDCoordinate* width, KDCoordinate* height,
+                    KDCoordinate* baseline) {
+  Entry* entry = EntryForKey(key);
+  if (entry->key != key) {
+    return false;
+  }
+  *width = entry->width;
+  *height = entry->height;
+  *baseline = entry->baseline;
+  return true;
+}
+
+void RackCache::SetSize(uint32_t key, KDSize size) {
+  Entry* entry = EntryForKey(key);
+  if (entry->key != key) {
+    *entry = {.key = key, .width = 0, .height = 0, .baseline = 0};
+  }
+  entry->width = size.width();
+  entry->height = size.height();
+}
+
+void RackCache::SetBaseline(uint32_t key, KDCoordinate baseline) {
+  Entry* entry = EntryForKey(key);
+  if (entry->key != key) {
+    *entry = {.key = key, .width = 0, .height = 0, .baseline = 0};
+  }
+  entry->baseline = baseline;
+}
+
+RackCache::KeyBuilder::KeyBuilder(KDFont::Size font, const Tree* cursorRack)
+    : m_cursorRack(cursorRack),
+      m_hash(0),
+      m_length(0),
+      m_depth(0),
+      m_overflow(false) {
+  /* The position of the base of logarithms changes the multiplication symbols
+   * drawn, it is the only preference read while rendering. */
+  bool logarithmBaseTopLeft =
+      Preferences::SharedPreferences()->logarithmBasePosition() ==
+      Preferences::LogarithmBasePosition::TopLeft;
+  m_seed = (static_cast<uint32_t>(font) << 1 | logarithmBaseTopLeft) *
+           0x9E3779B9;
+}
+
+void RackCache::KeyBuilder::visit(const Tree* node, Tree* memoizedRack) {
+  if (m_overflow) {
+    return;
+  }
+  if (m_depth == k_maxDepth) {
+    // Too deep to be tracked, the keys of the open racks stay k_noKey
+    m_overflow = true;
+    return;
+  }
+  m_frames[m_depth++] = {.memoizedRack = memoizedRack,
+                         .prefixHash = m_hash,
+                         .prefixLength = m_length,
+                         .remainingChildren = static_cast<uint16_t>(
+                             node->numberOfChildren()),
+                         .containsCursor = false};
+  if (node == m_cursorRack) {
+    for (int i = 0; i < m_depth; i++) {
+      m_frames[i].containsCursor = true;
+    }
+  }
+  const Block* block = node->block();
+  for (size_t i = 0; i < node->nodeSize(); i++) {
+    m_hash = m_hash * k_hashBase + static_cast<uint8_t>(block[i]);
+  }
+  m_length += node->nodeSize();
+  // Close the subtrees that end with this node
+  while (m_depth > 0 && m_frames[m_depth - 1].remainingChildren == 0) {
+    close(m_frames[--m_depth]);
+    if (m_depth > 0) {
+      m_frames[m_depth - 1].remainingChildren--;
+    }
+  }
+}
+
+void RackCache::KeyBuilder::close(const Frame& frame) {
+  if (!frame.memoizedRack || frame.containsCursor) {
+    return;
+  }
+  uint32_t length = m_length - frame.prefixLength;
+  uint32_t hash = m_hash - frame.prefixHash * Power(k_hashBase, length);
+  uint32_t key = (hash ^ m_seed) + length * 0x85EBCA6B;
+  if (key == k_noKey) {
+    key = 1;
+  }
+  auto* node = frame.memoizedRack->toRackMemoizedLayoutNode();
+  node->key = key;
+  KDCoordinate width, height, baseline;
+  if (Get(key, &width, &height, &baseline)) {
+    node->width = width;
+    node->height = height;
+    node->baseline = baseline;
+  }
+}
+
+}  // namespace Poincare::Internal
@@ -0,0 +1,81 @@
+#ifndef POINCARE_LAYOUT_RACK_CACHE_H
+#define POINCARE_LAYOUT_RACK_CACHE_H
+
+#include <kandinsky/coordinate.h>
+#include <kandinsky/font.h>
+#include <kandinsky/size.h>
+#include <poincare/src/memory/tree.h>
+#include <stdint.h>
+
+namespace Poincare::Internal {
+
+/* RackCache keeps the size and baseline of racks between Render calls, so
+ * that moving the cursor or typing in a large layout only measures again the
+ * racks that changed.
+ *
+ * Entries are keyed by a hash of the blocks of the rack and by the font, not by
+ * the address of the rack: each edit through the LayoutCursor builds a new
+ * layout in the pool, and the pool moves layouts when it compacts, so an
+ * address does not identify a rack for long. With a content key, the edited
+ * rack and its ancestors miss the cache while all the untouched racks hit it.
+ *
+ * The size of a rack containing the cursor depends on the cursor position
+ * (empty squares, gray grid placeholders), so those racks are never cached. */
+
+class RackCache {
+ public:
+  constexpr static uint32_t k_noKey = 0;
+
+  static void Reset();
+  // Return true and fill the values found, 0 meaning unknown
+  static bool Get(uint32_t key, KDCoordinate* width, KDCoordinate* height,
+                  KDCoordinate* baseline);
+  static void SetSize(uint32_t key, KDSize size);
+  static void SetBaseline(uint32_t key, KDCoordinate baseline);
+
+  /* Computes the keys of the racks of a tree while it is being cloned, in a
+   * single pass: a rack is hashed from the hash of the prefix of the tree
+   * before and after it. */
+  class KeyBuilder {
+   public:
+    KeyBuilder(KDFont::Size font, const Tree* cursorRack);
+    /* Call for each node of the original tree in order, with the node of the
+     * clone if it is a RackMemoized, to which the key is written. */
+    void visit(const Tree* node, Tree* memoizedRack);
+
+   private:
+    constexpr static int k_maxDepth = 64;
+    struct Frame {
+      Tree* memoizedRack;
+      uint32_t prefixHash;
+      uint32_t prefixLength;
+      uint16_t remainingChildren;
+      bool containsCursor;
+    };
+    void close(const Frame& frame);
+
+    Frame m_frames[k_maxDepth];
+    const Tree* m_cursorRack;
+    uint32_t m_hash;
+    uint32_t m_length;
+    uint32_t m_seed;
+    int m_depth;
+    bool m_overflow;
+  };
+
+ private:
+  constexpr static int k_numberOfEntries = 256;
+  struct Entry {
+    uint32_t key;
+    uint16_t width;
+    uint16_t height;
+    uint16_t baseline;
+  };
+  static Entry* EntryForKey(uint32_t key);
+
+  static Entry s_entries[k_numberOfEntries];
+};
+
+}  // namespace Poincare::Internal
+
+#endif
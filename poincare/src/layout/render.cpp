@@ -9,6 +9,7 @@
 #include "grid.h"
 #include "layout_cursor.h"
 #include "layout_selection.h"
+#include "rack_cache.h"
 #include "rack_layout.h"
 #include "render_masks.h"
 #include "render_metrics.h"
@@ -20,18 +21,23 @@ KDFont::Size Render::s_font = KDFont::Size::Large;
 /* Helpers */
 
 /* Clone rack replacing basic racks with memo racks and update the cursor to
- * make it point in the new tree. */
-static Tree* CloneWithRackMemoized(const Tree* l, SimpleLayoutCursor* cursor) {
+ * make it point in the new tree. The memo racks are filled with the values
+ * found in the RackCache. */
+static Tree* CloneWithRackMemoized(const Tree* l, SimpleLayoutCursor* cursor,
+                                   KDFont::Size font) {
   Tree* result = Tree::FromBlocks(SharedTreeStack->lastBlock());
+  RackCache::KeyBuilder keyBuilder(font, cursor->rack);
   for (const Tree* n : l->selfAndDescendants()) {
     assert(!n->isRackMemoizedLayout());
     if (cursor->rack == n) {
       cursor->rack = static_cast<const Rack*>(SharedTreeStack->lastBlock());
     }
     if (n->isRackLayout() && n->numberOfChildren() > 0) {
-      SharedTreeStack->pushRackMemoizedLayout(n->numberOfChildren());
+      keyBuilder.visit(
+          n, SharedTreeStack->pushRackMemoizedLayout(n->numberOfChildren()));
     } else {
       n->cloneNode();
+      keyBuilder.visit(n, nullptr);
     }
   }
   return result;
@@ -48,7 +54,7 @@ KDSize Render::SizeBetweenIndexes(const Tree* l, KDFont::Size fontSize,
   s_font = fontSize;
   SimpleLayoutCursor localCursor = cursor;
   RackLayout::s_cursor = &localCursor;
-  Tree* withMemoRoot = CloneWithRackMemoized(l, &localCursor);
+  Tree* withMemoRoot = CloneWithRackMemoized(l, &localCursor, s_font);
   KDSize result = RackLayout::SizeBetweenIndexes(
       static_cast<const Rack*>(withMemoRoot), leftIndex, rightIndex, false);
   withMemoRoot->removeTree();
@@ -65,7 +71,7 @@ KDCoordinate Render::BaselineBetweenIndexes(const Tree* l,
   s_font = fontSize;
   SimpleLayoutCursor localCursor = cursor;
   RackLayout::s_cursor = &localCursor;
-  Tree* withMemoRoot = CloneWithRackMemoized(l, &localCursor);
+  Tree* withMemoRoot = CloneWithRackMemoized(l, &localCursor, s_font);
   KDCoordinate result = RackLayout::BaselineBetweenIndexes(
       static_cast<const Rack*>(withMemoRoot), leftIndex, rightIndex);
   withMemoRoot->removeTree();
@@ -78,7 +84,7 @@ KDPoint Render::AbsoluteOrigin(const Tree* l, const Tree* root,
   s_font = fontSize;
   SimpleLayoutCursor localCursor = cursor;
   RackLayout::s_cursor = &localCursor;
-  Tree* withMemoRoot = CloneWithRackMemoized(root, &localCursor);
+  Tree* withMemoRoot = CloneWithRackMemoized(root, &localCursor, s_font);
   KDPoint result = AbsoluteOriginRec(localCursor.rack, withMemoRoot);
   withMemoRoot->removeTree();
   return result;
@@ -90,7 +96,7 @@ void Render::Draw(const Tree* l, KDContext* ctx, KDPoint p,
   Render::s_font = style.font;
   SimpleLayoutCursor localCursor = cursor;
   RackLayout::s_cursor = &localCursor;
-  Tree* withMemo = CloneWithRackMemoized(l, &localCursor);
+  Tree* withMemo = CloneWithRackMemoized(l, &localCursor, s_font);
   LayoutSelection localSelection =
       cursor.rack ? LayoutSelection(localCursor.rack, selection.startPosition(),
                                     selection.endPosition())
@@ -109,8 +115,12 @@ KDSize Render::Size(const Rack* l, bool showEmpty) {
   KDSize size = RackLayout::Size(l, showEmpty);
   if (l->isRackMemoizedLayout()) {
     assert(size.width() != 0);
-    const_cast<Rack*>(l)->toRackMemoizedLayoutNode()->width = size.width();
-    const_cast<Rack*>(l)->toRackMemoizedLayoutNode()->height = size.height();
+    auto* node = const_cast<Rack*>(l)->toRackMemoizedLayoutNode();
+    node->width = size.width();
+    node->height = size.height();
+    if (node->key != RackCache::k_noKey) {
+      RackCache::SetSize(node->key, size);
+    }
   }
   return size;
 }
@@ -123,7 +133,11 @@ KDCoordinate Render::Baseline(const Rack* l) {
   KDCoordinate baseline = RackLayout::Baseline(l);
   if (l->isRackMemoizedLayout()) {
     assert(baseline != 0);
-    const_cast<Rack*>(l)->toRackMemoizedLayoutNode()->baseline = baseline;
+    auto* node = const_cast<Rack*>(l)->toRackMemoizedLayoutNode();
+    node->baseline = baseline;
+    if (node->key != RackCache::k_noKey) {
+      RackCache::SetBaseline(node->key, baseline);
+    }
   }
   return baseline;
 }
@@ -464,25 +478,30 @@ KDPoint Render::AbsoluteOriginRec(const Tree* l, const Tree* root) {
 }
 
 KDPoint Grid::positionOfChildAt(int row, int column, KDFont::Size font) const {
-  KDCoordinate x = 0;
-  for (int j = 0; j < column; j++) {
-    x += columnWidth(j, font);
-  }
-  x += column * horizontalGridEntryMargin(font);
+  /* Read the column widths and row heights from the cumulated positions, to
+   * measure the grid once instead of once per preceding row and column. */
+  KDCoordinate columsCumulatedWidth[Matrix::k_maximumSize];
+  KDCoordinate rowCumulatedHeight[Matrix::k_maximumSize];
+  computePositions(font, rowCumulatedHeight, columsCumulatedWidth);
+  KDCoordinate x =
+      column == 0
+          ? 0
+          : columsCumulatedWidth[column - 1] + horizontalGridEntryMargin(font);
+  const Rack* child = childAt(row, column);
   if (column == 0 || !isSequenceLayout()) {
     // Center child, except for second column in sequence layout
-    x += (columnWidth(column, font) - Render::Width(childAt(row, column))) / 2;
-  }
-  KDCoordinate y = 0;
-  for (int i = 0; i < row; i++) {
-    y += rowHeight(i, font);
+    KDCoordinate columnWidth = columsCumulatedWidth[column] - x;
+    x += (columnWidth - Render::Width(child)) / 2;
   }
-  y += rowBaseline(row, font) - Render::Baseline(childAt(row, column)) +
-       row * verticalGridEntryMargin(font);
+  KDCoordinate y =
+      row == 0 ? 0
+               : rowCumulatedHeight[row - 1] + verticalGridEntryMargin(font);
+  y += rowBaseline(row, font) - Render::Baseline(child);
   KDPoint p(x, y);
   if (isMatrixLayout()) {
-    /* TODO calling height here is bad for complexity */
-    return p.translatedBy(SquareBrackets::ChildOffset(height(font)));
+    KDCoordinate height =
+        sizeGivenPositions(rowCumulatedHeight, columsCumulatedWidth).height();
+    return p.translatedBy(SquareBrackets::ChildOffset(height));
   }
   assert(isPiecewiseLayout() || isSequenceLayout());
   // Left margin is doubled in sequence layout
@@ -70,6 +70,9 @@ bool BlockStack::insertBlocks(Block* destination, const Block* source,
   if (m_size + numberOfBlocks > maxNumberOfBlocks()) {
     TreeStackCheckpoint::Raise(ExceptionType::TreeStackOverflow);
   }
+#if POINCARE_METRICS
+  m_peakSize = std::max(m_peakSize, m_size + numberOfBlocks);
+#endif
   size_t insertionSize = numberOfBlocks * sizeof(Block);
   if (at && destination == lastBlock()) {
     m_size += numberOfBlocks;
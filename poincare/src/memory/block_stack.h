@@ -24,6 +24,11 @@ class BlockStack {
   const Block* lastBlock() const { return m_blocks + m_size; }
   Block* lastBlock() { return m_blocks + m_size; }
   size_t size() const { return m_size; }
+#if POINCARE_METRICS
+  // Highest size reached since the last reset
+  size_t peakSize() const { return m_peakSize; }
+  void resetPeakSize() { m_peakSize = m_size; }
+#endif
   Block* blockAtIndex(int i) { return firstBlock() + i; }
 
   bool contains(const Block* block) const {
@@ -137,6 +142,9 @@ class BlockStack {
   Block* m_blocks;
   const size_t m_maxSize;
   size_t m_size = 0;
+#if POINCARE_METRICS
+  size_t m_peakSize = 0;
+#endif
 };
 
 }  // namespace Poincare::Internal
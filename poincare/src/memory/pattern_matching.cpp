@@ -7,6 +7,14 @@
 #include "n_ary.h"
 #include "type_block.h"
 
+#if POINCARE_PATTERN_MATCHING_STATS
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#endif
+
 using namespace Poincare::Internal;
 
 bool PatternMatching::Context::isUninitialized() const {
@@ -329,7 +337,31 @@ bool PatternMatching::MatchNodes(const Tree* source, const Tree* pattern,
 /* Since we use Match a lot with pattern's type not matching source, escape
  * early here to optimize a costly MatchContext constructor. */
 bool CanEarlyEscape(const Tree* pattern, const Tree* source) {
-  if (pattern->type() == source->type() || pattern->isPlaceholder()) {
+  if (pattern->isPlaceholder()) {
+    return false;
+  }
+  if (pattern->type() == source->type()) {
+    /* Unless an AnyTrees placeholder may absorb some of them, pattern's
+     * children are matched one by one with source's children, so that their
+     * types can be checked as well. This rejects most of the rules whose root
+     * type matches without walking the MatchNodes machinery. */
+    int numberOfChildren = pattern->numberOfChildren();
+    for (const Tree* child : pattern->children()) {
+      if (child->isPlaceholder() &&
+          Placeholder::NodeToFilter(child) != Placeholder::Filter::One) {
+        return false;
+      }
+    }
+    if (numberOfChildren != source->numberOfChildren()) {
+      return true;
+    }
+    const Tree* sourceChild = source->nextNode();
+    for (const Tree* child : pattern->children()) {
+      if (CanEarlyEscape(child, sourceChild)) {
+        return true;
+      }
+      sourceChild = sourceChild->nextTree();
+    }
     return false;
   }
   if (CannotBeSquashed(pattern)) {
@@ -350,8 +382,106 @@ bool CanEarlyEscape(const Tree* pattern, const Tree* source) {
   return false;
 }
 
+#if POINCARE_METRICS
+uint32_t PatternMatching::matchCount = 0;
+#endif
+
+#if POINCARE_PATTERN_MATCHING_STATS
+namespace {
+
+struct CallSiteStatistics {
+  const char* file;
+  uint32_t line;
+  uint32_t attempts;
+  uint32_t earlyEscapes;
+  uint32_t successes;
+  uint64_t nanoseconds;
+};
+
+constexpr int k_maxNumberOfCallSites = 1024;
+CallSiteStatistics s_callSites[k_maxNumberOfCallSites];
+
+CallSiteStatistics* StatisticsForCallSite(std::source_location callSite) {
+  // Call sites are few, an open addressing table on the line is enough
+  int index = callSite.line() % k_maxNumberOfCallSites;
+  for (int i = 0; i < k_maxNumberOfCallSites; i++) {
+    CallSiteStatistics* stats = &s_callSites[index];
+    if (stats->file == nullptr) {
+      *stats = {callSite.file_name(), callSite.line(), 0, 0, 0, 0};
+      return stats;
+    }
+    if (stats->line == callSite.line() &&
+        (stats->file == callSite.file_name() ||
+         std::strcmp(stats->file, callSite.file_name()) == 0)) {
+      return stats;
+    }
+    index = (index + 1) % k_maxNumberOfCallSites;
+  }
+  // There are much fewer call sites than entries
+  OMG::unreachable();
+}
+
+}  // namespace
+
+void PatternMatching::LogStatistics() {
+  CallSiteStatistics sorted[k_maxNumberOfCallSites];
+  int n = 0;
+  uint64_t totalNanoseconds = 0;
+  for (const CallSiteStatistics& stats : s_callSites) {
+    if (stats.file) {
+      sorted[n++] = stats;
+      totalNanoseconds += stats.nanoseconds;
+    }
+  }
+  std::sort(sorted, sorted + n,
+            [](const CallSiteStatistics& a, const CallSiteStatistics& b) {
+              return a.nanoseconds > b.nanoseconds;
+            });
+  std::cout << "Pattern matching statistics (" << n << " call sites, "
+            << totalNanoseconds / 1000 << " us)\n";
+  std::cout << std::setw(10) << "us" << std::setw(11) << "attempts"
+            << std::setw(11) << "escapes" << std::setw(11) << "successes"
+            << "  call site\n";
+  for (int i = 0; i < n; i++) {
+    const CallSiteStatistics& stats = sorted[i];
+    std::cout << std::setw(10) << stats.nanoseconds / 1000 << std::setw(11)
+              << stats.attempts << std::setw(11) << stats.earlyEscapes
+              << std::setw(11) << stats.successes << "  " << stats.file << ":"
+              << stats.line << "\n";
+  }
+}
+
+void PatternMatching::ResetStatistics() {
+  for (CallSiteStatistics& stats : s_callSites) {
+    stats = {};
+  }
+}
+#endif
+
 bool PatternMatching::Match(const Tree* source, const Tree* pattern,
-                            Context* context) {
+                            Context* context
+                                PATTERN_MATCHING_CALL_SITE_DEFINITION) {
+#if POINCARE_PATTERN_MATCHING_STATS
+  CallSiteStatistics* stats = StatisticsForCallSite(callSite);
+  stats->attempts++;
+  stats->earlyEscapes += CanEarlyEscape(pattern, source);
+  auto start = std::chrono::steady_clock::now();
+  bool success = PrivateMatch(source, pattern, context);
+  stats->nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now() - start)
+                            .count();
+  stats->successes += success;
+  return success;
+#else
+  return PrivateMatch(source, pattern, context);
+#endif
+}
+
+bool PatternMatching::PrivateMatch(const Tree* source, const Tree* pattern,
+                                   Context* context) {
+#if POINCARE_METRICS
+  matchCount++;
+#endif
   if (CanEarlyEscape(pattern, source)) {
     return false;
   }
@@ -469,17 +599,18 @@ Tree* PatternMatching::CreateTree(const Tree* structure, const Context context,
 }
 
 Tree* PatternMatching::MatchCreate(const Tree* source, const Tree* pattern,
-                                   const Tree* structure) {
+                                   const Tree* structure
+                                       PATTERN_MATCHING_CALL_SITE_DEFINITION) {
   Context ctx;
-  if (!Match(source, pattern, &ctx)) {
+  if (!Match(source, pattern, &ctx PATTERN_MATCHING_FORWARD_CALL_SITE)) {
     return nullptr;
   }
   return Create(structure, ctx);
 }
 
-bool PatternMatching::PrivateMatchReplace(Tree* source, const Tree* pattern,
-                                          const Tree* structure,
-                                          bool simplify) {
+bool PatternMatching::PrivateMatchReplace(
+    Tree* source, const Tree* pattern, const Tree* structure,
+    bool simplify PATTERN_MATCHING_CALL_SITE_DEFINITION) {
   Context ctx;
   // Escape case for full matches like A -> cos(A)
   if (pattern->isPlaceholder()) {
@@ -489,7 +620,7 @@ bool PatternMatching::PrivateMatchReplace(Tree* source, const Tree* pattern,
   }
 
   // Step 1 - Match the pattern
-  if (!Match(source, pattern, &ctx)) {
+  if (!Match(source, pattern, &ctx PATTERN_MATCHING_FORWARD_CALL_SITE)) {
     return false;
   }
 
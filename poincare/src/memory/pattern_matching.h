@@ -6,12 +6,29 @@
 #include <poincare/src/expression/variables.h>
 
 #include <array>
+#if POINCARE_PATTERN_MATCHING_STATS
+#include <source_location>
+#endif
 
 #include "k_tree.h"
 #include "placeholder.h"
 #include "tree.h"
 #include "tree_ref.h"
 
+/* With POINCARE_PATTERN_MATCHING_STATS, each public match method takes the
+ * location of its caller as a defaulted last argument, so that statistics are
+ * collected per call site without changing the call sites. */
+#if POINCARE_PATTERN_MATCHING_STATS
+#define PATTERN_MATCHING_CALL_SITE \
+  , std::source_location callSite = std::source_location::current()
+#define PATTERN_MATCHING_CALL_SITE_DEFINITION , std::source_location callSite
+#define PATTERN_MATCHING_FORWARD_CALL_SITE , callSite
+#else
+#define PATTERN_MATCHING_CALL_SITE
+#define PATTERN_MATCHING_CALL_SITE_DEFINITION
+#define PATTERN_MATCHING_FORWARD_CALL_SITE
+#endif
+
 namespace Poincare::Internal {
 
 struct ContextTrees {
@@ -161,7 +178,8 @@ class PatternMatching {
   }
 #endif
 
-  static bool Match(const Tree* source, const Tree* pattern, Context* context);
+  static bool Match(const Tree* source, const Tree* pattern,
+                    Context* context PATTERN_MATCHING_CALL_SITE);
   static Tree* Create(const Tree* structure, const Context context = Context(),
                       bool simplify = false) {
     return CreateTree(structure, context, nullptr, simplify, 0);
@@ -181,21 +199,40 @@ class PatternMatching {
     return Create(structure, Context(context, scopes), true);
   }
   static Tree* MatchCreate(const Tree* source, const Tree* pattern,
-                           const Tree* structure);
+                           const Tree* structure PATTERN_MATCHING_CALL_SITE);
   // Return true if reference has been replaced
   static bool MatchReplace(Tree* source, const Tree* pattern,
-                           const Tree* structure, bool simplify = false) {
-    return PrivateMatchReplace(source, pattern, structure, simplify);
+                           const Tree* structure,
+                           bool simplify = false PATTERN_MATCHING_CALL_SITE) {
+    return PrivateMatchReplace(source, pattern, structure,
+                               simplify PATTERN_MATCHING_FORWARD_CALL_SITE);
   }
   // Return true if reference has been replaced
-  static bool MatchReplaceSimplify(Tree* source, const Tree* pattern,
-                                   const Tree* structure) {
-    return PrivateMatchReplace(source, pattern, structure, true);
+  static bool MatchReplaceSimplify(
+      Tree* source, const Tree* pattern,
+      const Tree* structure PATTERN_MATCHING_CALL_SITE) {
+    return PrivateMatchReplace(source, pattern, structure,
+                               true PATTERN_MATCHING_FORWARD_CALL_SITE);
   }
 
+#if POINCARE_METRICS
+  static uint32_t matchCount;
+#endif
+
+#if POINCARE_PATTERN_MATCHING_STATS
+  /* Log the number of attempts, successes and the time spent matching for
+   * each call site, sorted by decreasing time. Early escapes are attempts
+   * rejected by the cheap type pre-filter before walking the pattern. */
+  static void LogStatistics();
+  static void ResetStatistics();
+#endif
+
  private:
-  static bool PrivateMatchReplace(Tree* source, const Tree* pattern,
-                                  const Tree* structure, bool simplify);
+  static bool PrivateMatchReplace(
+      Tree* source, const Tree* pattern, const Tree* structure,
+      bool simplify PATTERN_MATCHING_CALL_SITE_DEFINITION);
+  static bool PrivateMatch(const Tree* source, const Tree* pattern,
+                           Context* context);
 
   static bool TrimSourceTree(Tree* source, Context* ctx);
 
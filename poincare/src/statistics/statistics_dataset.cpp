@@ -1,7 +1,6 @@
 #include "statistics_dataset.h"
 
 #include <omg/float.h>
-#include <omg/list.h>
 
 #include <algorithm>
 #include <cmath>
@@ -162,10 +161,14 @@ int StatisticsDataset<T>::indexAtCumulatedWeight(T weight,
     }
     return -1;
   }
+  int elementIndex;
+  if (selectIndexAtCumulatedWeight(weight, &elementIndex, upperIndex)) {
+    return elementIndex;
+  }
   T epsilon = sizeof(T) == sizeof(double) ? DBL_EPSILON : FLT_EPSILON;
   int length = datasetLength();
   int elementSortedIndex = -1;
-  int elementIndex = -1;
+  elementIndex = -1;
   T elementWeight = 0.0;
   T cumulatedWeight = 0.0;
   for (int i = 0; i < length; i++) {
@@ -199,53 +202,106 @@ int StatisticsDataset<T>::indexAtCumulatedWeight(T weight,
   return elementIndex;
 }
 
+namespace {
+
+/* Order values increasingly with undefined values last. Equal values are
+ * ordered by index so that sorting and selecting are deterministic and behave
+ * as a stable sort. */
+template <typename T>
+class SortedIndexOrder {
+ public:
+  SortedIndexOrder(const DatasetColumn<T>* values) : m_values(values) {}
+  bool operator()(int i, int j) const {
+    T a = m_values->valueAtIndex(i);
+    T b = m_values->valueAtIndex(j);
+    if (std::isnan(a) || std::isnan(b)) {
+      return std::isnan(a) != std::isnan(b) ? std::isnan(b) : i < j;
+    }
+    return a != b ? a < b : i < j;
+  }
+
+ private:
+  const DatasetColumn<T>* m_values;
+};
+
+template <typename I>
+void fillWithIdentity(I* indexes, int length) {
+  for (int i = 0; i < length; i++) {
+    indexes[i] = i;
+  }
+}
+
+}  // namespace
+
+template <typename T>
+bool StatisticsDataset<T>::selectIndexAtCumulatedWeight(
+    T weight, int* index, int* upperIndex) const {
+  int length = datasetLength();
+  /* All weights are 1 when there are no weights and no undefined values. The
+   * element at cumulated weight is then the k-th smallest value. */
+  if (!m_recomputeSortedIndex || m_weights != nullptr || length == 0 ||
+      std::isnan(totalWeight())) {
+    return false;
+  }
+  T epsilon = sizeof(T) == sizeof(double) ? DBL_EPSILON : FLT_EPSILON;
+  // Same as the first k such that cumulatedWeight = k + 1 >= weight - epsilon
+  int k = static_cast<int>(std::clamp<T>(std::ceil(weight - epsilon), 1.0,
+                                         length)) -
+          1;
+  SortedIndexOrder<T> order(m_values);
+  withSortedIndexStorage([&](auto* indexes) {
+    fillWithIdentity(indexes, length);
+    std::nth_element(indexes, indexes + k, indexes + length, order);
+    *index = indexes[k];
+    if (upperIndex) {
+      *upperIndex = *index;
+      if (k + 1 < length &&
+          std::fabs(static_cast<T>(k + 1) - weight) < epsilon) {
+        *upperIndex =
+            *std::min_element(indexes + k + 1, indexes + length, order);
+      }
+    }
+  });
+  // The storage is left partially sorted
+  assert(m_recomputeSortedIndex);
+  return true;
+}
+
 template <typename T>
 int StatisticsDataset<T>::indexAtSortedIndex(int i) const {
   buildMemoizedSortedIndex();
-  return static_cast<int>(m_sortedIndex[i]);
+  return withSortedIndexStorage(
+      [i](auto* indexes) { return static_cast<int>(indexes[i]); });
 }
 
+template <typename T>
+template <typename F>
+auto StatisticsDataset<T>::withSortedIndexStorage(F f) const {
 #ifndef TARGET_POINCARE_JS
-using MemoizedIndexType = uint8_t;
+  if (!m_sortedIndexArena.empty()) {
+    assert(datasetLength() <= static_cast<int>(m_sortedIndexArena.size()));
+    return f(m_sortedIndexArena.data());
+  }
+  assert(datasetLength() <= k_maxLengthForSortedIndex);
+  return f(m_sortedIndex);
 #else
-using MemoizedIndexType = int;
+  if (m_sortedIndex == nullptr) {
+    m_sortedIndex = new int[datasetLength()];
+  }
+  return f(m_sortedIndex);
 #endif
+}
 
 template <typename T>
 void StatisticsDataset<T>::buildMemoizedSortedIndex() const {
   if (!m_recomputeSortedIndex) {
     return;
   }
-
   int length = datasetLength();
-#ifndef TARGET_POINCARE_JS
-  assert(length < k_maxLengthForSortedIndex);
-#else
-  assert(m_sortedIndex == nullptr);
-  m_sortedIndex = new int[length];
-#endif
-
-  for (int i = 0; i < length; i++) {
-    m_sortedIndex[i] = i;
-  }
-  void* pack[] = {&(m_sortedIndex[0]), const_cast<DatasetColumn<T>*>(m_values)};
-  OMG::List::Sort(
-      [](int i, int j, void* ctx, int n) {  // swap
-        void** pack = reinterpret_cast<void**>(ctx);
-        MemoizedIndexType* sortedIndex =
-            reinterpret_cast<MemoizedIndexType*>(pack[0]);
-        std::swap(sortedIndex[i], sortedIndex[j]);
-      },
-      [](int i, int j, void* ctx, int n) {  // compare
-        void** pack = reinterpret_cast<void**>(ctx);
-        MemoizedIndexType* sortedIndex =
-            reinterpret_cast<MemoizedIndexType*>(pack[0]);
-        DatasetColumn<T>* values = reinterpret_cast<DatasetColumn<T>*>(pack[1]);
-        return std::isnan(values->valueAtIndex(sortedIndex[i])) ||
-               values->valueAtIndex(sortedIndex[i]) >=
-                   values->valueAtIndex(sortedIndex[j]);
-      },
-      pack, datasetLength());
+  withSortedIndexStorage([&](auto* indexes) {
+    fillWithIdentity(indexes, length);
+    std::sort(indexes, indexes + length, SortedIndexOrder<T>(m_values));
+  });
   m_recomputeSortedIndex = false;
 }
 
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <span>
 
 #include "statistics_dataset_column.h"
 
@@ -33,6 +34,13 @@
  * Indeed, the object memoizes m_sortedIndex and recomputes it only if you
  * ask it to.
  * (for example, that's what we do in Apps::Statistics::Store)
+ * Sorting is in O(n*log(n)). A single quantile of an unweighted dataset whose
+ * sortedIndex is not memoized is selected in O(n) instead.
+ *
+ * === LENGTH ===
+ * The sortedIndex of up to k_maxLengthForSortedIndex values is stored in the
+ * object. Longer datasets need a caller-provided arena of 16-bit indexes (see
+ * setSortedIndexArena).
  *
  * === ENHANCEMENTS ===
  * More statistics method could be implemented here if factorization is needed.
@@ -84,6 +92,19 @@ class StatisticsDataset {
 
   bool isUndefined() { return m_values == nullptr; }
 
+#ifndef TARGET_POINCARE_JS
+  constexpr static int k_maxLengthForSortedIndex = 256;
+
+  /* The arena must hold at least datasetLength() indexes for as long as the
+   * dataset is used. It is only needed above k_maxLengthForSortedIndex
+   * values. */
+  void setSortedIndexArena(std::span<uint16_t> arena) {
+    assert(arena.size() <= UINT16_MAX + 1);
+    m_sortedIndexArena = arena;
+    m_recomputeSortedIndex = true;
+  }
+#endif
+
 #ifdef TARGET_POINCARE_JS
   void deleteSortedIndex() {
     if (m_sortedIndex != nullptr) {
@@ -144,8 +165,8 @@ class StatisticsDataset {
   T standardDeviation() const { return std::sqrt(variance()); }
   T sampleStandardDeviation() const;
 
-  /* All the following methods need sortedIndex and are way faster with a
-   * length < 256. */
+  // All the following methods need sortedIndex
+
   T sortedElementAtCumulatedFrequency(T freq, bool createMiddleElement) const;
   T sortedElementAtCumulatedWeight(T weight, bool createMiddleElement) const;
   T median() const {
@@ -175,12 +196,20 @@ class StatisticsDataset {
   T privateTotalWeight() const;
 
   void buildMemoizedSortedIndex() const;
+  /* Select the index at cumulated weight without sorting the whole dataset.
+   * Return false if the dataset is not eligible (weighted, undefined values or
+   * already sorted). */
+  bool selectIndexAtCumulatedWeight(T weight, int* index,
+                                    int* upperIndex) const;
+  // Call f on the sortedIndex storage, which has datasetLength() elements
+  template <typename F>
+  auto withSortedIndexStorage(F f) const;
 
   const DatasetColumn<T>* m_values;
   const DatasetColumn<T>* m_weights;
 #ifndef TARGET_POINCARE_JS
-  constexpr static int k_maxLengthForSortedIndex = 256;
   mutable uint8_t m_sortedIndex[k_maxLengthForSortedIndex];
+  std::span<uint16_t> m_sortedIndexArena;
 #else
   // Use a malloced array to avoid the 256 elements limit
   mutable int* m_sortedIndex = nullptr;
@@ -0,0 +1,168 @@
+#include <poincare/print.h>
+#include <poincare/src/expression/approximation.h>
+#include <poincare/src/expression/approximation_program.h>
+#include <quiz/stopwatch.h>
+
+#include <cmath>
+#include <span>
+
+#include "helper.h"
+
+using namespace Poincare::Internal;
+
+constexpr const char* k_programFunctions[] = {
+    "x",
+    "3x^2-2x+1",
+    "sin(x)+cos(2x)",
+    "tan(x)",
+    "x/(x-1)",
+    "1/x+x^(-2)",
+    "√(x)",
+    "√(x^2-4)",
+    "e^(-x^2/2)",
+    "ln(x)",
+    "ln(x^2)",
+    "log(x,3)",
+    "x^(1/3)",
+    "(x-2)^(2/3)",
+    "x^x",
+    "abs(x-3)",
+    "arctan(x)+cot(x)",
+    "sinh(x)-tanh(x)",
+    "floor(x)+frac(x)",
+    "sign(x)*x",
+    "x/x",
+    "cos(x)/sin(x)",
+    "1/0",
+    "i*x",
+};
+
+template <typename T>
+void assert_program_approximates_like_tree(const Tree* e,
+                                           const Approximation::Program& p,
+                                           T x) {
+  T expected = Approximation::To<T>(
+      e, x, Approximation::Parameters{.isRootAndCanHaveRandom = true});
+  T value = p.to<T>(x);
+  bool result = (std::isnan(expected) && std::isnan(value)) ||
+                expected == value;
+#if POINCARE_TREE_LOG
+  if (!result) {
+    std::cout << "Program approximation test failure at x = " << x
+              << " with:\n";
+    e->log();
+    std::cout << "Approximated to " << value << " instead of " << expected
+              << "\n";
+  }
+#endif
+  quiz_assert(result);
+}
+
+template <typename T>
+void assert_batch_approximates_like_program(const Approximation::Program& p,
+                                            std::span<const double> x) {
+  constexpr size_t k_maxNumberOfValues = 64;
+  assert(x.size() <= k_maxNumberOfValues);
+  T abscissas[k_maxNumberOfValues];
+  T values[k_maxNumberOfValues];
+  for (size_t i = 0; i < x.size(); i++) {
+    abscissas[i] = x[i];
+  }
+  p.to<T>(std::span<const T>(abscissas, x.size()),
+          std::span<T>(values, x.size()));
+  for (size_t i = 0; i < x.size(); i++) {
+    T expected = p.to<T>(abscissas[i]);
+    quiz_assert((std::isnan(expected) && std::isnan(values[i])) ||
+                expected == values[i]);
+  }
+}
+
+void assert_program_is_equivalent_to_tree(const char* function,
+                                          ComplexFormat complexFormat) {
+  ProjectionContext ctx = {.m_complexFormat = complexFormat};
+  Tree* e = parseAndPrepareForApproximation(function, ctx);
+  Approximation::Program program = Approximation::Program::Compile(e);
+  quiz_assert(program.isValid());
+  constexpr double k_values[] = {-1e300, -100.0, -3.0, -1.0, -0.5, 0.0,
+                                 1e-10,  0.5,    1.0,  1.5,  2.0,  3.0,
+                                 10.0,   1e300,  NAN,  INFINITY};
+  for (double x : k_values) {
+    assert_program_approximates_like_tree<double>(e, program, x);
+    assert_program_approximates_like_tree<float>(e, program, x);
+  }
+  assert_batch_approximates_like_program<double>(program, k_values);
+  assert_batch_approximates_like_program<float>(program, k_values);
+  double grid[55];
+  for (int i = 0; i < 55; i++) {
+    grid[i] = -10.0 + 0.37 * i;
+    assert_program_approximates_like_tree<double>(e, program, grid[i]);
+    assert_program_approximates_like_tree<float>(e, program, grid[i]);
+  }
+  assert_batch_approximates_like_program<double>(program, grid);
+  assert_batch_approximates_like_program<float>(program, grid);
+  e->removeTree();
+}
+
+QUIZ_CASE(pcj_approximation_program) {
+  for (const char* function : k_programFunctions) {
+    assert_program_is_equivalent_to_tree(function, ComplexFormat::Real);
+    assert_program_is_equivalent_to_tree(function, ComplexFormat::Cartesian);
+  }
+
+  // Unhandled trees
+  constexpr const char* k_unhandledFunctions[] = {
+      "random()+x",
+      "{1,2}+x",
+      "piecewise(x,x>0,-x)",
+      "diff(x^3,x,x)",
+  };
+  for (const char* function : k_unhandledFunctions) {
+    Tree* e = parseAndPrepareForApproximation(function);
+    quiz_assert(!Approximation::Program::Compile(e).isValid());
+    e->removeTree();
+  }
+}
+
+QUIZ_CASE(pcj_approximation_program_benchmark) {
+  constexpr int k_numberOfPoints = 19200;
+  constexpr size_t k_bufferSize = 100;
+  char buffer[k_bufferSize];
+  for (const char* function : k_programFunctions) {
+    Tree* e = parseAndPrepareForApproximation(function);
+    Approximation::Program program = Approximation::Program::Compile(e);
+    float sum = 0.0f;
+    uint64_t treeTime = quiz_stopwatch_start();
+    for (int i = 0; i < k_numberOfPoints; i++) {
+      sum += Approximation::To<float>(
+          e, static_cast<float>(i) / 1000.0f,
+          Approximation::Parameters{.isRootAndCanHaveRandom = true});
+    }
+    treeTime = quiz_stopwatch_start() - treeTime;
+    uint64_t programTime = quiz_stopwatch_start();
+    for (int i = 0; i < k_numberOfPoints; i++) {
+      sum += program.to<float>(static_cast<float>(i) / 1000.0f);
+    }
+    programTime = quiz_stopwatch_start() - programTime;
+    uint64_t batchTime = quiz_stopwatch_start();
+    constexpr int k_batchLength = 320;
+    float abscissas[k_batchLength];
+    float values[k_batchLength];
+    for (int i = 0; i < k_numberOfPoints; i += k_batchLength) {
+      for (int j = 0; j < k_batchLength; j++) {
+        abscissas[j] = static_cast<float>(i + j) / 1000.0f;
+      }
+      program.to<float>(abscissas, values);
+      sum += values[0];
+    }
+    batchTime = quiz_stopwatch_start() - batchTime;
+    Poincare::Print::CustomPrintf(
+        buffer, k_bufferSize,
+        "  %s: tree %ims, program %ims, batch %ims (%i ops)", function,
+        static_cast<int>(treeTime), static_cast<int>(programTime),
+        static_cast<int>(batchTime), program.numberOfInstructions());
+    quiz_print(buffer);
+    // Prevent the loops from being optimized away
+    quiz_assert(sum == sum || std::isnan(sum));
+    e->removeTree();
+  }
+}
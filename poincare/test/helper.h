@@ -3,6 +3,7 @@
 
 #include <poincare/context.h>
 #include <poincare/preferences.h>
+#include <poincare/src/expression/advanced_reduction.h>
 #include <poincare/src/expression/approximation.h>
 #include <poincare/src/expression/projection.h>
 #include <poincare/src/expression/simplification.h>
@@ -94,6 +95,8 @@ inline void assertionsWarn() {
   {                                                                       \
     Poincare::Internal::Tree::nextNodeCount = 0;                          \
     Poincare::Internal::Tree::nextNodeInTreeStackCount = 0;               \
+    Poincare::Internal::AdvancedReduction::memoHitCount = 0;              \
+    Poincare::Internal::AdvancedReduction::memoMissCount = 0;             \
     int refId;                                                            \
     {                                                                     \
       Poincare::Internal::TreeRef r =                                     \
@@ -121,6 +124,10 @@ inline void assertionsWarn() {
               << "\n  nextNodeOutOfStack:" << std::right << std::setw(6)  \
               << Poincare::Internal::Tree::nextNodeCount -                \
                      Poincare::Internal::Tree::nextNodeInTreeStackCount   \
+              << "\n  memoHit:       " << std::right << std::setw(6)      \
+              << Poincare::Internal::AdvancedReduction::memoHitCount      \
+              << "\n  memoMiss:      " << std::right << std::setw(6)      \
+              << Poincare::Internal::AdvancedReduction::memoMissCount     \
               << "\n  microseconds:  " << std::right << std::setw(6)      \
               << std::chrono::duration_cast<std::chrono::microseconds>(   \
                      elapsed)                                             \
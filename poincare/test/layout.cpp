@@ -1,14 +1,18 @@
 #include <ion/display.h>
 #include <omg/unicode_helper.h>
+#include <poincare/print.h>
 #include <poincare/src/expression/k_tree.h>
 #include <poincare/src/layout/grid.h>
 #include <poincare/src/layout/k_tree.h>
+#include <poincare/src/layout/layout_cursor.h>
 #include <poincare/src/layout/layout_serializer.h>
 #include <poincare/src/layout/layout_span_decoder.h>
 #include <poincare/src/layout/layouter.h>
 #include <poincare/src/layout/multiplication_symbol.h>
+#include <poincare/src/layout/rack_cache.h>
 #include <poincare/src/layout/rack_layout_decoder.h>
 #include <poincare/src/layout/render.h>
+#include <quiz/stopwatch.h>
 
 #include "helper.h"
 
@@ -144,3 +148,80 @@ QUIZ_CASE(pcj_layout_serialization) {
                                   KParenthesesLeftTempL("x"_l),
                               "1+log(x,abc)");
 }
+
+struct CursorMetrics {
+  KDPoint origin = KDPointZero;
+  KDCoordinate height = 0;
+  KDSize rootSize = KDSizeZero;
+  KDCoordinate rootBaseline = 0;
+  bool operator==(const CursorMetrics& other) const {
+    return origin == other.origin && height == other.height &&
+           rootSize == other.rootSize && rootBaseline == other.rootBaseline;
+  }
+};
+
+/* Measure the layout for each position of the cursor, as a layout field does
+ * after each key stroke, and return the number of positions. */
+static int measure_every_cursor_position(Tree* layout, bool resetCache,
+                                         CursorMetrics* metrics) {
+  constexpr KDFont::Size font = KDFont::Size::Large;
+  Rack* root = Rack::From(layout);
+  int numberOfPositions = 0;
+  for (Tree* rack : layout->selfAndDescendants()) {
+    if (!rack->isRackLayout()) {
+      continue;
+    }
+    for (int position = 0; position <= rack->numberOfChildren(); position++) {
+      if (resetCache) {
+        RackCache::Reset();
+      }
+      TreeCursor cursor(root, Rack::From(rack), position);
+      metrics[numberOfPositions++] = {
+          .origin = cursor.cursorAbsoluteOrigin(font),
+          .height = cursor.cursorHeight(font),
+          .rootSize = Render::Size(root, font, cursor.simpleCursor()),
+          .rootBaseline = Render::Baseline(root, font, cursor.simpleCursor())};
+    }
+  }
+  return numberOfPositions;
+}
+
+static void assert_rack_cache_is_transparent(const char* input) {
+  constexpr int k_maxNumberOfPositions = 512;
+  CursorMetrics cached[k_maxNumberOfPositions];
+  CursorMetrics uncached[k_maxNumberOfPositions];
+  Tree* layout = Layouter::LayoutExpression(parse(input));
+  uint64_t uncachedTime = quiz_stopwatch_start();
+  int numberOfPositions =
+      measure_every_cursor_position(layout, true, uncached);
+  uncachedTime = quiz_stopwatch_start() - uncachedTime;
+  assert(numberOfPositions <= k_maxNumberOfPositions);
+  RackCache::Reset();
+  uint64_t cachedTime = quiz_stopwatch_start();
+  measure_every_cursor_position(layout, false, cached);
+  cachedTime = quiz_stopwatch_start() - cachedTime;
+  for (int i = 0; i < numberOfPositions; i++) {
+    quiz_assert_print_if_failure(cached[i] == uncached[i], input);
+  }
+  constexpr size_t k_bufferSize = 100;
+  char buffer[k_bufferSize];
+  Poincare::Print::CustomPrintf(
+      buffer, k_bufferSize, "  %i cursor positions: %ims, %ims with cache",
+      numberOfPositions, static_cast<int>(uncachedTime),
+      static_cast<int>(cachedTime));
+  quiz_print(buffer);
+  layout->removeTree();
+}
+
+QUIZ_CASE(pcj_layout_rack_cache) {
+  assert_rack_cache_is_transparent(
+      "[[11,12,13,14,15,16,17,18,19,10][21,22,23,24,25,26,27,28,29,20]"
+      "[31,32,33,34,35,36,37,38,39,30][41,42,43,44,45,46,47,48,49,40]"
+      "[51,52,53,54,55,56,57,58,59,50][61,62,63,64,65,66,67,68,69,60]"
+      "[71,72,73,74,75,76,77,78,79,70][81,82,83,84,85,86,87,88,89,80]"
+      "[91,92,93,94,95,96,97,98,99,90][1,2,3,4,5,6,7,8,9,0]]");
+  assert_rack_cache_is_transparent(
+      "1+1/(2+1/(3+1/(4+1/(5+1/(6+1/(7+1/(8+1/(9+1/(10+x^2)))))))))");
+  assert_rack_cache_is_transparent(
+      "√(1+[[1,2][3,4]]^(1/2))-e^(1/x)+[[x][y]]");
+}
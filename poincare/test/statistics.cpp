@@ -0,0 +1,113 @@
+#include <poincare/print.h>
+#include <poincare/src/statistics/statistics_dataset.h>
+#include <quiz/stopwatch.h>
+
+#include <cmath>
+
+#include "helper.h"
+
+using namespace Poincare::Internal;
+
+class ArrayDatasetColumn : public DatasetColumn<double> {
+ public:
+  ArrayDatasetColumn(const double* values, int length)
+      : m_values(values), m_length(length) {}
+  double valueAtIndex(int index) const override { return m_values[index]; }
+  int length() const override { return m_length; }
+
+ private:
+  const double* m_values;
+  int m_length;
+};
+
+static void assert_median_is(const double* values, int length,
+                             double expectedMedian, int expectedIndex,
+                             int expectedUpperIndex) {
+  ArrayDatasetColumn column(values, length);
+  // A fresh dataset selects the median, a sorted one walks its sortedIndex
+  StatisticsDataset<double> selected(&column);
+  StatisticsDataset<double> sorted(&column);
+  sorted.indexAtSortedIndex(0);
+  for (StatisticsDataset<double>* dataset : {&selected, &sorted}) {
+    int upperIndex;
+    quiz_assert(dataset->medianIndex(&upperIndex) == expectedIndex);
+    quiz_assert(upperIndex == expectedUpperIndex);
+  }
+  selected.setHasBeenModified();
+  quiz_assert(selected.median() == expectedMedian);
+  quiz_assert(sorted.median() == expectedMedian);
+}
+
+QUIZ_CASE(pcj_statistics_dataset_order) {
+  constexpr double values[] = {4.0, 2.0, 3.0, 2.0, 1.0};
+  assert_median_is(values, 5, 2.0, 3, 3);
+  assert_median_is(values, 4, 2.5, 3, 2);
+  // Equal values are ordered by index
+  constexpr double ties[] = {2.0, 1.0, 2.0, 2.0};
+  assert_median_is(ties, 4, 2.0, 0, 2);
+  // Undefined values are sorted last
+  constexpr double undefined[] = {NAN, 3.0, NAN, 1.0};
+  ArrayDatasetColumn column(undefined, 4);
+  StatisticsDataset<double> dataset(&column);
+  quiz_assert(dataset.indexAtSortedIndex(0) == 3);
+  quiz_assert(dataset.indexAtSortedIndex(1) == 1);
+  quiz_assert(dataset.indexAtSortedIndex(2) == 0);
+  quiz_assert(dataset.indexAtSortedIndex(3) == 2);
+  quiz_assert(std::isnan(dataset.median()));
+  // Weighted datasets
+  constexpr double weights[] = {1.0, 0.0, 2.0, 1.0, 1.0};
+  ArrayDatasetColumn valuesColumn(values, 5);
+  ArrayDatasetColumn weightsColumn(weights, 5);
+  StatisticsDataset<double> weighted(&valuesColumn, &weightsColumn);
+  quiz_assert(weighted.median() == 3.0);
+  quiz_assert(weighted.sortedElementAtCumulatedFrequency(1.0 / 4.0, false) ==
+              2.0);
+}
+
+static uint64_t s_seed = 1;
+
+static double pseudoRandom() {
+  s_seed = s_seed * 6364136223846793005ull + 1442695040888963407ull;
+  return static_cast<double>(s_seed >> 44);
+}
+
+QUIZ_CASE(pcj_statistics_dataset_large_columns) {
+  constexpr int k_maxLength = 10000;
+  static double values[k_maxLength];
+  static uint16_t arena[k_maxLength];
+  constexpr size_t k_bufferSize = 100;
+  char buffer[k_bufferSize];
+  for (int length : {1000, 10000}) {
+    for (int i = 0; i < length; i++) {
+      values[i] = pseudoRandom();
+    }
+    ArrayDatasetColumn column(values, length);
+    StatisticsDataset<double> dataset(&column);
+    dataset.setSortedIndexArena(std::span<uint16_t>(arena, length));
+
+    uint64_t selectionTime = quiz_stopwatch_start();
+    double median = dataset.median();
+    selectionTime = quiz_stopwatch_start() - selectionTime;
+
+    uint64_t sortTime = quiz_stopwatch_start();
+    double min = dataset.min();
+    sortTime = quiz_stopwatch_start() - sortTime;
+
+    quiz_assert(dataset.median() == median);
+    quiz_assert(dataset.max() >= median && min <= median);
+    for (int i = 1; i < length; i++) {
+      quiz_assert(values[dataset.indexAtSortedIndex(i - 1)] <=
+                  values[dataset.indexAtSortedIndex(i)]);
+    }
+    int numberOfSmallerValues = 0;
+    for (int i = 0; i < length; i++) {
+      numberOfSmallerValues += values[i] < median;
+    }
+    quiz_assert(numberOfSmallerValues <= length / 2);
+    Poincare::Print::CustomPrintf(buffer, k_bufferSize,
+                                  "  %i values: median %ims, sort %ims",
+                                  length, static_cast<int>(selectionTime),
+                                  static_cast<int>(sortTime));
+    quiz_print(buffer);
+  }
+}
@@ -0,0 +1,70 @@
+# Compare per-pixel and bulk kandinsky drawing throughput.
+# Copy this script onto the calculator and run bench().
+from kandinsky import *
+from time import monotonic
+
+W = 160
+H = 80
+
+
+def per_pixel():
+  for y in range(H):
+    for x in range(W):
+      set_pixel(x, y, (x, y, 128))
+
+
+def row_list():
+  for y in range(H):
+    set_pixels(0, y, W, [(x, y, 128) for x in range(W)])
+
+
+def offscreen_buffer(band=20):
+  # Little-endian RGB565 bands drawn offscreen, each flushed at once
+  flush = 0
+  for y0 in range(0, H, band):
+    rows = []
+    for y in range(y0, y0 + band):
+      row = []
+      for x in range(W):
+        c = (x >> 3) << 11 | y << 5 | 16
+        row.append(c & 0xFF)
+        row.append(c >> 8)
+      rows.append(bytes(row))
+    buffer = b''.join(rows)
+    start = monotonic()
+    set_pixels(0, y0, W, buffer)
+    flush += monotonic() - start
+  return flush
+
+
+def polyline():
+  xs = [x for x in range(0, 320, 2)]
+  ys = [100 + (x * 7) % 100 for x in xs]
+  for _ in range(10):
+    draw_polyline(xs, ys, 'blue')
+
+
+def segments():
+  xs = [x for x in range(0, 320, 2)]
+  ys = [100 + (x * 7) % 100 for x in xs]
+  for _ in range(10):
+    for i in range(1, len(xs)):
+      x0, y0, x1, y1 = xs[i - 1], ys[i - 1], xs[i], ys[i]
+      n = max(abs(x1 - x0), abs(y1 - y0))
+      for k in range(n + 1):
+        set_pixel(x0 + (x1 - x0) * k // n, y0 + (y1 - y0) * k // n, 'blue')
+
+
+def bench():
+  results = []
+  for name, f in (('per pixel', per_pixel), ('row list', row_list),
+                  ('offscreen buffer', offscreen_buffer),
+                  ('set_pixel segments', segments),
+                  ('draw_polyline', polyline)):
+    start = monotonic()
+    flush = f()
+    results.append((name, monotonic() - start, flush))
+  for name, duration, flush in results:
+    print(name, int(1000 * duration), 'ms')
+    if flush is not None:
+      print('  flush', int(1000 * flush), 'ms')
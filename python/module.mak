@@ -182,6 +182,13 @@ _sources_python_test := $(patsubst %,test/%:+test, \
   turtle.cpp \
 )
 
+# Sampling profiler: print the hotspots of each script on the standard output
+
+PYTHON_PROFILER ?= 0
+ifneq ($(PYTHON_PROFILER),0)
+_sources_python_port += port/profiler.cpp
+endif
+
 # Workarounds - begin
 
 # Rename urandom to random
@@ -230,6 +237,10 @@ SFLAGS_python := \
 
 SFLAGS_python += -DULAB_CONFIG_FILE="\"numworks_ulab_config.h\""
 
+ifneq ($(PYTHON_PROFILER),0)
+PRIVATE_SFLAGS_python += -DPYTHON_PROFILER=1
+endif
+
 # QSTR generation
 
 PYTHON_QSTRDEFS := $(OUTPUT_DIRECTORY)/$(PATH_python)/port/genhdr/qstrdefs.generated.h
@@ -403,10 +403,12 @@ Q(KEY_EXE)
 // Kandinsky QSTRs
 Q(kandinsky)
 Q(color)
+Q(draw_polyline)
 Q(draw_string)
 Q(fill_rect)
 Q(get_pixel)
 Q(set_pixel)
+Q(set_pixels)
 
 // Matplotlib QSTRs
 Q(arrow)
@@ -2,11 +2,46 @@
 
 #include <ion.h>
 
+#include <algorithm>
+
 #include "port.h"
+#if PYTHON_PROFILER
+#include "profiler.h"
+#endif
 extern "C" {
 #include "mphalport.h"
 }
 
+int32_t micropython_port_vm_hook_budget = 1;
+
+void micropython_port_vm_hook_budget_expired(
+    const struct _mp_code_state_t* codeState, const uint8_t* ip) {
+  /* Reading the clock at each VM hook slows down tight loops, especially on
+   * the device where it is a system call. The budget of hooks is adapted so
+   * that it runs out about every k_budgetPeriod ms, but never lasts more than
+   * k_maxBudget hooks, in case the following iterations are much slower. */
+  constexpr static uint64_t k_budgetPeriod = 5;
+  constexpr static int32_t k_maxBudget = 256;
+  static int32_t budget = 1;
+  static uint64_t lastExpiry = 0;
+
+  uint64_t now = Ion::Timing::millis();
+  uint64_t elapsed = now - lastExpiry;
+  lastExpiry = now;
+  if (elapsed == 0) {
+    budget = std::min(2 * budget, k_maxBudget);
+  } else {
+    budget = std::clamp<int64_t>(budget * k_budgetPeriod / elapsed, 1,
+                                 k_maxBudget);
+  }
+  micropython_port_vm_hook_budget = budget;
+
+#if PYTHON_PROFILER
+  MicroPython::Profiler::Sample(codeState, ip);
+#endif
+  micropython_port_vm_hook_loop();
+}
+
 bool micropython_port_vm_hook_loop() {
   /* This function is called very frequently by the MicroPython engine. We grab
    * this opportunity to interrupt execution and/or refresh the display on
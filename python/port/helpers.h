@@ -8,6 +8,15 @@ extern "C" {
 #include <stdbool.h>
 #include <stdint.h>
 
+/* MICROPY_VM_HOOK_LOOP decrements micropython_port_vm_hook_budget at each
+ * backward jump of the VM, and only calls
+ * micropython_port_vm_hook_budget_expired once it runs out. code_state and ip
+ * locate the bytecode being executed. */
+struct _mp_code_state_t;
+extern int32_t micropython_port_vm_hook_budget;
+void micropython_port_vm_hook_budget_expired(
+    const struct _mp_code_state_t* code_state, const uint8_t* ip);
+
 // These methods return true if they have been interrupted
 bool micropython_port_vm_hook_loop();
 void micropython_port_vm_hook_refresh_print();
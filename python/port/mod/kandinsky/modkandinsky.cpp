@@ -5,6 +5,8 @@ extern "C" {
 }
 #include <ion/display.h>
 
+#include <algorithm>
+
 #include "port.h"
 
 static mp_obj_t TupleForKDColor(KDColor c) {
@@ -57,6 +59,89 @@ mp_obj_t modkandinsky_set_pixel(mp_obj_t x, mp_obj_t y, mp_obj_t input) {
   return mp_const_none;
 }
 
+/* set_pixels draws numberOfPixels colors row by row, width pixels per row,
+ * from (x, y). The colors are either a list or a tuple of colors, or a
+ * bytes-like object of little-endian RGB565 colors that a script can build as
+ * an offscreen buffer. The colors are pushed by chunks to cross into the
+ * display only once per chunk instead of once per pixel. */
+
+class PixelsReader {
+ public:
+  PixelsReader(mp_obj_t colors) : m_buffer(nullptr) {
+    if (mp_obj_is_str(colors)) {
+      mp_raise_TypeError("Colors must be a list or bytes");
+    }
+    mp_buffer_info_t bufferInfo;
+    if (mp_get_buffer(colors, &bufferInfo, MP_BUFFER_READ)) {
+      if (bufferInfo.len % sizeof(KDColor) != 0) {
+        mp_raise_ValueError("RGB565 colors are 2 bytes long");
+      }
+      m_buffer = static_cast<const uint8_t *>(bufferInfo.buf);
+      m_numberOfPixels = bufferInfo.len / sizeof(KDColor);
+    } else {
+      mp_obj_get_array(colors, &m_numberOfPixels, &m_items);
+    }
+  }
+  size_t numberOfPixels() const { return m_numberOfPixels; }
+  KDColor colorAtIndex(size_t index) const {
+    assert(index < m_numberOfPixels);
+    if (m_buffer) {
+      const uint8_t *color = m_buffer + index * sizeof(KDColor);
+      return KDColor::RGB16(color[0] | (color[1] << 8));
+    }
+    return MicroPython::Color::Parse(m_items[index]);
+  }
+
+ private:
+  const uint8_t *m_buffer;
+  mp_obj_t *m_items;
+  size_t m_numberOfPixels;
+};
+
+mp_obj_t modkandinsky_set_pixels(size_t n_args, const mp_obj_t *args) {
+  mp_int_t x = mp_obj_get_int(args[0]);
+  mp_int_t y = mp_obj_get_int(args[1]);
+  mp_int_t width = mp_obj_get_int(args[2]);
+  if (width <= 0) {
+    mp_raise_ValueError("width must be positive");
+  }
+  PixelsReader reader(args[3]);
+  size_t numberOfPixels = reader.numberOfPixels();
+
+  constexpr static int k_bufferSize = 256;
+  KDColor buffer[k_bufferSize];
+  size_t index = 0;
+  while (index < numberOfPixels) {
+    mp_int_t row = index / width;
+    mp_int_t column = index % width;
+    size_t remaining = numberOfPixels - index;
+    // Push whole rows at once when they fit in the buffer
+    mp_int_t chunkHeight =
+        column == 0 && width <= k_bufferSize
+            ? std::min<size_t>(k_bufferSize / width, remaining / width)
+            : 0;
+    mp_int_t chunkWidth = width;
+    if (chunkHeight == 0) {
+      chunkHeight = 1;
+      chunkWidth = std::min<size_t>(
+          {static_cast<size_t>(width - column), k_bufferSize, remaining});
+    }
+    mp_int_t chunkSize = chunkWidth * chunkHeight;
+    for (mp_int_t i = 0; i < chunkSize; i++) {
+      buffer[i] = reader.colorAtIndex(index + i);
+    }
+    if (index == 0) {
+      // The first colors were parsed before hiding the console
+      MicroPython::ExecutionEnvironment::currentExecutionEnvironment()
+          ->displaySandbox();
+    }
+    Ion::Display::Context::SharedContext->fillRectWithPixels(
+        KDRect(x + column, y + row, chunkWidth, chunkHeight), buffer, nullptr);
+    index += chunkSize;
+  }
+  return mp_const_none;
+}
+
 // TODO Use good colors
 mp_obj_t modkandinsky_draw_string(size_t n_args, const mp_obj_t *args) {
   const char *text = mp_obj_str_get_str(args[0]);
@@ -95,3 +180,31 @@ mp_obj_t modkandinsky_fill_rect(size_t n_args, const mp_obj_t *args) {
   Ion::Display::Context::SharedContext->fillRect(rect, color);
   return mp_const_none;
 }
+
+mp_obj_t modkandinsky_draw_polyline(mp_obj_t xs, mp_obj_t ys, mp_obj_t color) {
+  size_t numberOfPoints, numberOfYs;
+  mp_obj_t *xItems, *yItems;
+  mp_obj_get_array(xs, &numberOfPoints, &xItems);
+  mp_obj_get_array(ys, &numberOfYs, &yItems);
+  if (numberOfPoints != numberOfYs) {
+    mp_raise_ValueError("x and y must have same length");
+  }
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    mp_obj_get_int(xItems[i]);
+    mp_obj_get_int(yItems[i]);
+  }
+  KDColor kdColor = MicroPython::Color::Parse(color);
+  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()
+      ->displaySandbox();
+  if (numberOfPoints == 1) {
+    Ion::Display::Context::SharedContext->setPixel(
+        KDPoint(mp_obj_get_int(xItems[0]), mp_obj_get_int(yItems[0])), kdColor);
+  }
+  for (size_t i = 1; i < numberOfPoints; i++) {
+    Ion::Display::Context::SharedContext->drawLine(
+        KDPoint(mp_obj_get_int(xItems[i - 1]), mp_obj_get_int(yItems[i - 1])),
+        KDPoint(mp_obj_get_int(xItems[i]), mp_obj_get_int(yItems[i])),
+        kdColor);
+  }
+  return mp_const_none;
+}
@@ -132,7 +132,10 @@
 // Allow even more operations on numpy arrays from both sides
 #define MICROPY_PY_ALL_SPECIAL_METHODS (1)
 
-#define MICROPY_VM_HOOK_LOOP micropython_port_vm_hook_loop();
+#define MICROPY_VM_HOOK_LOOP                               \
+  if (--micropython_port_vm_hook_budget <= 0) {            \
+    micropython_port_vm_hook_budget_expired(code_state, ip); \
+  }
 
 typedef intptr_t mp_int_t;    // must be pointer size
 typedef uintptr_t mp_uint_t;  // must be pointer size
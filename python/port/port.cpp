@@ -33,6 +33,10 @@ extern "C" {
 
 #include <escher/palette.h>
 
+#if PYTHON_PROFILER
+#include "profiler.h"
+#endif
+
 static MicroPython::ScriptProvider* sScriptProvider = nullptr;
 static MicroPython::ExecutionEnvironment* sCurrentExecutionEnvironment =
     nullptr;
@@ -73,6 +77,10 @@ bool MicroPython::ExecutionEnvironment::runCode(const char* str) {
   // Disable the user interruption
   mp_hal_set_interrupt_char(-1);
 
+#if PYTHON_PROFILER
+  MicroPython::Profiler::DumpAndReset();
+#endif
+
   assert(sCurrentExecutionEnvironment == this);
   sCurrentExecutionEnvironment = nullptr;
   return runSucceeded;
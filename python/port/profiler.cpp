@@ -0,0 +1,91 @@
+#include "profiler.h"
+
+#include <stdio.h>
+
+#include <algorithm>
+
+extern "C" {
+#include "py/bc.h"
+#include "py/objfun.h"
+#include "py/qstr.h"
+}
+
+namespace MicroPython {
+namespace Profiler {
+
+struct Hotspot {
+  qstr sourceFile;
+  qstr blockName;
+  size_t line;
+  uint32_t numberOfSamples;
+};
+
+constexpr static int k_maxNumberOfHotspots = 32;
+constexpr static int k_numberOfDumpedHotspots = 10;
+static Hotspot sHotspots[k_maxNumberOfHotspots];
+static int sNumberOfHotspots = 0;
+static uint32_t sNumberOfSamples = 0;
+
+void Sample(const _mp_code_state_t* codeState, const uint8_t* ip) {
+  /* Find the line of ip as the VM does when it builds a traceback. */
+  const byte* prelude = codeState->fun_bc->bytecode;
+  MP_BC_PRELUDE_SIG_DECODE(prelude);
+  MP_BC_PRELUDE_SIZE_DECODE(prelude);
+  const byte* bytecodeStart = prelude + n_info + n_cell;
+#if !MICROPY_PERSISTENT_CODE
+  bytecodeStart =
+      static_cast<const byte*>(MP_ALIGN(bytecodeStart, sizeof(mp_uint_t)));
+#endif
+  size_t offset = ip - bytecodeStart;
+#if MICROPY_PERSISTENT_CODE
+  qstr blockName = prelude[0] | (prelude[1] << 8);
+  qstr sourceFile = prelude[2] | (prelude[3] << 8);
+  prelude += 4;
+#else
+  qstr blockName = mp_decode_uint_value(prelude);
+  prelude = mp_decode_uint_skip(prelude);
+  qstr sourceFile = mp_decode_uint_value(prelude);
+  prelude = mp_decode_uint_skip(prelude);
+#endif
+  size_t line = mp_bytecode_get_source_line(prelude, offset);
+
+  sNumberOfSamples++;
+  for (int i = 0; i < sNumberOfHotspots; i++) {
+    Hotspot* hotspot = &sHotspots[i];
+    if (hotspot->line == line && hotspot->sourceFile == sourceFile &&
+        hotspot->blockName == blockName) {
+      hotspot->numberOfSamples++;
+      return;
+    }
+  }
+  if (sNumberOfHotspots < k_maxNumberOfHotspots) {
+    sHotspots[sNumberOfHotspots++] = {sourceFile, blockName, line, 1};
+  }
+  // Otherwise the sample only counts in the total
+}
+
+void DumpAndReset() {
+  if (sNumberOfSamples == 0) {
+    return;
+  }
+  std::sort(sHotspots, sHotspots + sNumberOfHotspots,
+            [](const Hotspot& a, const Hotspot& b) {
+              return a.numberOfSamples > b.numberOfSamples;
+            });
+  printf("Python profile: %u samples\n",
+         static_cast<unsigned>(sNumberOfSamples));
+  int numberOfDumpedHotspots =
+      std::min(sNumberOfHotspots, k_numberOfDumpedHotspots);
+  for (int i = 0; i < numberOfDumpedHotspots; i++) {
+    const Hotspot& hotspot = sHotspots[i];
+    printf("%5.1f%% %s:%u in %s\n",
+           100.0 * hotspot.numberOfSamples / sNumberOfSamples,
+           qstr_str(hotspot.sourceFile), static_cast<unsigned>(hotspot.line),
+           qstr_str(hotspot.blockName));
+  }
+  sNumberOfHotspots = 0;
+  sNumberOfSamples = 0;
+}
+
+}  // namespace Profiler
+}  // namespace MicroPython
@@ -0,0 +1,23 @@
+#ifndef PYTHON_PORT_PROFILER_H
+#define PYTHON_PORT_PROFILER_H
+
+#include <stdint.h>
+
+struct _mp_code_state_t;
+
+namespace MicroPython {
+
+/* The profiler samples the line executed by the VM each time the budget of
+ * the VM hook runs out. Once a script has run, it prints on the standard
+ * output the lines that were sampled the most. */
+namespace Profiler {
+
+void Sample(const _mp_code_state_t* codeState, const uint8_t* ip);
+// Print the hotspots sampled since the last dump and forget them
+void DumpAndReset();
+
+}  // namespace Profiler
+
+}  // namespace MicroPython
+
+#endif
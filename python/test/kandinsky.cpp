@@ -27,3 +27,21 @@ QUIZ_CASE(python_kandinsky_basics) {
   assert_command_execution_succeeds(env, "draw_string('hello',0,0)");
   deinit_environment();
 }
+
+QUIZ_CASE(python_kandinsky_bulk) {
+  TestExecutionEnvironment env = init_environment();
+  assert_command_execution_succeeds(env, "from kandinsky import *");
+  assert_command_execution_succeeds(
+      env, "set_pixels(0,0,2,[(255,0,0),(0,0,255),'green'])");
+  assert_command_execution_succeeds(
+      env, "set_pixels(0,0,300,bytes([0,248])*700)");
+  assert_command_execution_succeeds(env, "set_pixels(0,0,1,[])");
+  assert_command_execution_fails(env, "set_pixels(0,0,2,bytes(3))");
+  assert_command_execution_fails(env, "set_pixels(0,0,0,[(0,0,0)])");
+  assert_command_execution_fails(env, "set_pixels(0,0,2,'abcd')");
+  assert_command_execution_succeeds(
+      env, "draw_polyline([0,10,10],[0,0,10],(0,0,255))");
+  assert_command_execution_succeeds(env, "draw_polyline([3],[3],'red')");
+  assert_command_execution_fails(env, "draw_polyline([0,1],[0],'red')");
+  deinit_environment();
+}
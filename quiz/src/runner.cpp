@@ -1,5 +1,8 @@
 #include <ion.h>
 #include <poincare/print.h>
+#if POINCARE_PATTERN_MATCHING_STATS
+#include <poincare/src/memory/pattern_matching.h>
+#endif
 
 #include "quiz.h"
 #include "runner_helpers.h"
@@ -135,6 +138,9 @@ static inline void ion_main_inner(const char* testFilter,
   time = Ion::Timing::millis() - time;
   Poincare::Print::CustomPrintf(buffer, k_bufferSize, "DURATION: %i ms", time);
   quiz_print(buffer);
+#if POINCARE_PATTERN_MATCHING_STATS
+  Poincare::Internal::PatternMatching::LogStatistics();
+#endif
 #ifdef PLATFORM_DEVICE
   while (1) {
     Ion::Timing::msleep(100000);